@@ -0,0 +1,118 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include "../cc/common/Problem.h"
+#include "../cc/common/TransitionTable.h"
+#include "../cc/ndga/RandomBitVectorBuilder.h"
+#include "../core/evaluation/Evaluator.h"
+#include "../core/initialization/Initializer.h"
+
+/**
+ * A synthetic evaluation function whose duration follows a heavy-tailed Pareto distribution, i.e. most individuals
+ * are evaluated quickly while a few of them take up to a hundred times longer. It simulates evaluation functions
+ * that call external simulations and therefore waits instead of computing.
+ *
+ * @author  Felix Voelker
+ * @version 0.1.0
+ * @since   27.1.2018
+ */
+class HeavyTailedEval : public EvaluationFunction {
+
+public:
+    /**
+     * @param scale Minimal duration of an evaluation in microseconds.
+     * @param shape Shape of the Pareto distribution, i.e. smaller values yield heavier tails.
+     * @param limit Maximal duration of an evaluation as a multiple of the scale.
+     */
+    explicit HeavyTailedEval(double scale, double shape, double limit)
+            : EvaluationFunction(), scale(scale), shape(shape), limit(limit) {}
+
+    EvaluationFunction * clone() const override {
+        return new HeavyTailedEval(*this);
+    }
+
+    void operator()(Individual &individual, Thread &thread) override {
+        double duration = std::min(scale / std::pow(1.0 - thread.random.sample(), 1.0 / shape), limit * scale);
+        std::this_thread::sleep_for(std::chrono::microseconds(static_cast<long>(duration)));
+        individual.getRelevance().setFitness(1);
+    }
+
+protected:
+    double scale;
+    double shape;
+    double limit;
+
+    HeavyTailedEval(const HeavyTailedEval &obj) = default;
+
+};
+
+/**
+ * Measures the latency of each generation's evaluation phase for a given scheduling strategy and prints the mean,
+ * median and 99th percentile of these latencies.
+ */
+void benchmark(const std::string &name, common::Configuration &configuration, EvaluationFunction &eval, unsigned int generations) {
+    auto *featurevector = new FeatureVector(configuration);
+    auto *relevance = new Relevance(configuration);
+    auto *prototype = new BitVectorIndividual(configuration, *featurevector, *relevance);
+    auto *builder = new RandomBitVectorBuilder(configuration, *prototype);
+    auto *network = new TransitionTable(configuration);
+    auto *pool = new ThreadPool(configuration);
+    auto *population = new Population(configuration);
+    unsigned int epoch = 0;
+    auto *initializer = new Initializer(configuration, *builder, epoch, *pool);
+    auto *evaluator = new Evaluator(configuration, eval, *network, *pool);
+
+    initializer->initializePopulation(*population);
+    std::vector<double> latencies(generations);
+    for (unsigned int k = 0; k < generations; k++) {
+        auto start = std::chrono::steady_clock::now();
+        evaluator->evaluatePopulation(*population);
+        auto end = std::chrono::steady_clock::now();
+        latencies.at(k) = std::chrono::duration<double, std::milli>(end - start).count();
+    }
+
+    double mean = 0;
+    for (double latency : latencies)
+        mean += latency / generations;
+    std::sort(latencies.begin(), latencies.end());
+    std::cout << name
+              << ": mean " << mean << " ms"
+              << ", p50 " << latencies.at(generations / 2) << " ms"
+              << ", p99 " << latencies.at(generations * 99 / 100) << " ms" << std::endl;
+
+    delete evaluator;
+    delete initializer;
+    delete population;
+    delete pool;
+    delete network;
+    delete builder;
+    delete prototype;
+    delete relevance;
+    delete featurevector;
+}
+
+int main() {
+    unsigned int popsize = 512;
+    unsigned int threads = std::max(4u, std::thread::hardware_concurrency());
+    unsigned int generations = 50;
+
+    auto *eval = new HeavyTailedEval(50, 1.1, 100);
+    auto *problem = new common::Problem(*eval, popsize, 8);
+    auto *configuration = new common::Configuration(dynamic_cast<common::Configuration::ProblemConfiguration &>(problem->getConfiguration()));
+    configuration->getInitializerConfiguration().threads = threads;
+    configuration->getEvaluatorConfiguration().threads = threads;
+    std::cout << "Evaluating " << popsize << " individuals on " << threads << " threads over " << generations << " generations." << std::endl;
+
+    configuration->getEvaluatorConfiguration().grainsize = (popsize + threads - 1) / threads;
+    configuration->getEvaluatorConfiguration().stealing = false;
+    benchmark("Static partition", *configuration, *eval, generations);
+
+    configuration->getEvaluatorConfiguration().grainsize = 4;
+    configuration->getEvaluatorConfiguration().stealing = true;
+    benchmark("Work stealing   ", *configuration, *eval, generations);
+
+    delete configuration;
+    delete problem;
+    delete eval;
+}
@@ -0,0 +1,89 @@
+#include <bitset>
+#include "BitVectorIndividual.h"
+
+const unsigned int BitVectorIndividual::WORD_SIZE;
+
+BitVectorIndividual::BitVectorIndividual(const common::Configuration &configuration,
+                                         FeatureVector &featurevector,
+                                         Relevance &relevance)
+        : Individual(configuration, featurevector, relevance)
+{
+    auto problem = dynamic_cast<const common::Configuration::ProblemConfiguration &>(configuration.getProblemConfiguration());
+    this->genes = problem.genes;
+    this->chromosome = std::vector<std::uint64_t>((genes + WORD_SIZE - 1) / WORD_SIZE, 0);
+}
+
+std::string BitVectorIndividual::toString() {
+    std::string str(genes, '0');
+    for (unsigned int k = 0; k < genes; k++) {
+        if (getGene(k))
+            str.at(k) = '1';
+    }
+    return str;
+}
+
+BitVectorIndividual * BitVectorIndividual::clone() const {
+    return new BitVectorIndividual(*this);
+}
+
+bool BitVectorIndividual::assign(const Individual &obj) {
+    auto *other = dynamic_cast<const BitVectorIndividual *>(&obj);
+    if (other == nullptr)
+        return false;
+
+    assignState(obj);
+    this->genes = other->genes;
+    this->chromosome.assign(other->chromosome.begin(), other->chromosome.end());
+    return true;
+}
+
+bool BitVectorIndividual::hash(unsigned long long &key) const {
+    key = genes;
+    for (std::uint64_t word : chromosome) {
+        key = (key ^ word) * 0x9e3779b97f4a7c15ull;
+        key ^= key >> 32;
+    }
+    return true;
+}
+
+bool BitVectorIndividual::getGene(unsigned int locus) const {
+    return (chromosome.at(locus / WORD_SIZE) >> (locus % WORD_SIZE) & 1) != 0;
+}
+
+void BitVectorIndividual::setGene(unsigned int locus, bool gene) {
+    std::uint64_t bit = std::uint64_t(1) << (locus % WORD_SIZE);
+    if (gene) {
+        chromosome.at(locus / WORD_SIZE) |= bit;
+    } else {
+        chromosome.at(locus / WORD_SIZE) &= ~bit;
+    }
+}
+
+void BitVectorIndividual::flipGene(unsigned int locus) {
+    chromosome.at(locus / WORD_SIZE) ^= std::uint64_t(1) << (locus % WORD_SIZE);
+}
+
+unsigned int BitVectorIndividual::countOnes() const {
+    unsigned int ones = 0;
+    for (std::uint64_t word : chromosome)
+        ones += std::bitset<WORD_SIZE>(word).count();
+    return ones;
+}
+
+std::uint64_t BitVectorIndividual::getTailMask() const {
+    unsigned int tail = genes % WORD_SIZE;
+    return tail == 0 ? ~std::uint64_t(0) : (std::uint64_t(1) << tail) - 1;
+}
+
+unsigned int BitVectorIndividual::getGenes() const {
+    return genes;
+}
+
+std::vector<std::uint64_t> & BitVectorIndividual::getChromosome() {
+    return chromosome;
+}
+
+BitVectorIndividual::BitVectorIndividual(const BitVectorIndividual &obj) : Individual(obj) {
+    this->genes = obj.genes;
+    this->chromosome = obj.chromosome;
+}
@@ -0,0 +1,67 @@
+#ifndef RATATOSKR_BITVECTORINDIVIDUAL_H
+#define RATATOSKR_BITVECTORINDIVIDUAL_H
+
+
+#include <cstdint>
+#include <vector>
+#include "../../core/representation/Individual.h"
+#include "Configuration.h"
+#include "FeatureVector.h"
+
+/**
+ * A bit vector individual as used by Neuro-Dynamic Genetic Algorithms (NDGAs). In contrast to a vector individual,
+ * the binary genes of its chromosome are packed into 64-bit words, i.e. the k-th gene is stored as the (k mod 64)-th
+ * bit of the (k div 64)-th word. Unused bits of the last word are always cleared, thus genetic operators and
+ * evaluation functions can process whole words at once.
+ *
+ * @author  Felix Voelker
+ * @version 0.1.0
+ * @since   27.1.2018
+ */
+class BitVectorIndividual : public Individual {
+
+public:
+    static const unsigned int WORD_SIZE = 64;
+
+    explicit BitVectorIndividual(const common::Configuration &configuration,
+                                 FeatureVector &featurevector,
+                                 Relevance &relevance);
+
+    /**
+     * Returns a human readable bit string representation of the chromosome.
+     */
+    std::string toString() override;
+
+    BitVectorIndividual * clone() const override;
+
+    bool assign(const Individual &obj) override;
+
+    bool hash(unsigned long long &key) const override;
+
+    bool getGene(unsigned int locus) const;
+    void setGene(unsigned int locus, bool gene);
+    void flipGene(unsigned int locus);
+
+    /**
+     * Counts the number of set genes within the chromosome.
+     */
+    unsigned int countOnes() const;
+
+    /**
+     * Returns the mask of the used bits within the last word of the chromosome.
+     */
+    std::uint64_t getTailMask() const;
+
+    unsigned int getGenes() const;
+    std::vector<std::uint64_t> & getChromosome();
+
+protected:
+    unsigned int genes;
+    std::vector<std::uint64_t> chromosome;
+
+    BitVectorIndividual(const BitVectorIndividual &obj);
+
+};
+
+
+#endif //RATATOSKR_BITVECTORINDIVIDUAL_H
@@ -13,7 +13,21 @@ common::Configuration::CrossoverConfiguration::CrossoverConfiguration(const Cros
 }
 
 common::Configuration::MutationConfiguration::MutationConfiguration(const MutationConfiguration &obj) {
-    this->mutation_rate = mutation_rate;
+    this->mutation_rate = obj.mutation_rate;
+    this->geometric = obj.geometric;
+}
+
+common::Configuration::TransitionTableConfiguration::TransitionTableConfiguration(const TransitionTableConfiguration &obj) {
+    this->capacity = obj.capacity;
+}
+
+common::Configuration::MultilayerPerceptronConfiguration::MultilayerPerceptronConfiguration(const MultilayerPerceptronConfiguration &obj) {
+    this->hidden = obj.hidden;
+}
+
+common::Configuration::LinearApproximatorConfiguration::LinearApproximatorConfiguration(const LinearApproximatorConfiguration &obj) {
+    this->bits = obj.bits;
+    this->ngram = obj.ngram;
 }
 
 common::Configuration::Configuration(const ProblemConfiguration &problem)
@@ -33,4 +47,28 @@ common::Configuration::MutationConfiguration & common::Configuration::getMutatio
 
 const common::Configuration::MutationConfiguration & common::Configuration::getMutationConfiguration() const {
     return mutation;
+}
+
+common::Configuration::TransitionTableConfiguration & common::Configuration::getTransitionTableConfiguration() {
+    return transitiontable;
+}
+
+const common::Configuration::TransitionTableConfiguration & common::Configuration::getTransitionTableConfiguration() const {
+    return transitiontable;
+}
+
+common::Configuration::MultilayerPerceptronConfiguration & common::Configuration::getMultilayerPerceptronConfiguration() {
+    return multilayerperceptron;
+}
+
+const common::Configuration::MultilayerPerceptronConfiguration & common::Configuration::getMultilayerPerceptronConfiguration() const {
+    return multilayerperceptron;
+}
+
+common::Configuration::LinearApproximatorConfiguration & common::Configuration::getLinearApproximatorConfiguration() {
+    return linearapproximator;
+}
+
+const common::Configuration::LinearApproximatorConfiguration & common::Configuration::getLinearApproximatorConfiguration() const {
+    return linearapproximator;
 }
\ No newline at end of file
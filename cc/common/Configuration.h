@@ -34,11 +34,53 @@ namespace common {
             float xover_rate = 0.7f;
         };
 
+        /**
+         * The configuration of mutations.
+         * @param mutation_rate Probability that a single locus is mutated.
+         * @param geometric     Determines whether the gaps between mutated loci are sampled from a geometric
+         *                      distribution instead of sampling each locus on its own.
+         */
         struct MutationConfiguration {
             MutationConfiguration() = default;
             MutationConfiguration(const MutationConfiguration &obj);
 
             float mutation_rate = 0.001f;
+            bool geometric = true;
+        };
+
+        /**
+         * The configuration of transition tables.
+         * @param capacity Maximum number of states stored for each slot of the population, 0 for no bound.
+         */
+        struct TransitionTableConfiguration {
+            TransitionTableConfiguration() = default;
+            TransitionTableConfiguration(const TransitionTableConfiguration &obj);
+
+            unsigned int capacity = 0;
+        };
+
+        /**
+         * The configuration of multilayer perceptrons.
+         * @param hidden Number of hidden units.
+         */
+        struct MultilayerPerceptronConfiguration {
+            MultilayerPerceptronConfiguration() = default;
+            MultilayerPerceptronConfiguration(const MultilayerPerceptronConfiguration &obj);
+
+            unsigned int hidden = 32;
+        };
+
+        /**
+         * The configuration of linear approximators.
+         * @param bits  Number of bits of the hashed feature indices, at most 30, i.e. there are 2^bits weights.
+         * @param ngram Number of consecutive genes that form a feature, e.g. 1 for gene-position pairs. Within [1, 32].
+         */
+        struct LinearApproximatorConfiguration {
+            LinearApproximatorConfiguration() = default;
+            LinearApproximatorConfiguration(const LinearApproximatorConfiguration &obj);
+
+            unsigned int bits = 16;
+            unsigned int ngram = 2;
         };
 
         explicit Configuration(const ProblemConfiguration &problem);
@@ -48,10 +90,19 @@ namespace common {
         const CrossoverConfiguration & getCrossoverConfiguration() const;
         MutationConfiguration & getMutationConfiguration();
         const MutationConfiguration & getMutationConfiguration() const;
+        TransitionTableConfiguration & getTransitionTableConfiguration();
+        const TransitionTableConfiguration & getTransitionTableConfiguration() const;
+        MultilayerPerceptronConfiguration & getMultilayerPerceptronConfiguration();
+        const MultilayerPerceptronConfiguration & getMultilayerPerceptronConfiguration() const;
+        LinearApproximatorConfiguration & getLinearApproximatorConfiguration();
+        const LinearApproximatorConfiguration & getLinearApproximatorConfiguration() const;
 
     protected:
         CrossoverConfiguration crossover;
         MutationConfiguration mutation;
+        TransitionTableConfiguration transitiontable;
+        MultilayerPerceptronConfiguration multilayerperceptron;
+        LinearApproximatorConfiguration linearapproximator;
 
     };
 }
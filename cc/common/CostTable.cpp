@@ -0,0 +1,103 @@
+#include "CostTable.h"
+
+CostTable::CostTable(unsigned int capacity) {
+    this->capacity = capacity;
+    unsigned long long buckets = 16;
+    while (capacity > 0 && buckets < 2ull * capacity)
+        buckets <<= 1;
+    mask = buckets - 1;
+    entries = std::vector<Entry>(buckets);
+}
+
+float CostTable::get(unsigned long long key) const {
+    const Entry &entry = entries[find(key)];
+    return entry.used ? entry.cost : 0;
+}
+
+void CostTable::set(unsigned long long key, float cost) {
+    unsigned long long bucket = find(key);
+    if (!entries[bucket].used) {
+        if (capacity > 0 && size >= capacity) {
+            evict();
+            bucket = find(key);
+        } else if (capacity == 0 && 2ull * (size + 1) > entries.size()) {
+            grow();
+            bucket = find(key);
+        }
+        entries[bucket].key = key;
+        entries[bucket].used = true;
+        size++;
+    }
+    entries[bucket].cost = cost;
+    entries[bucket].referenced = true;
+}
+
+bool CostTable::contains(unsigned long long key) const {
+    return entries[find(key)].used;
+}
+
+unsigned int CostTable::getCapacity() const {
+    return capacity;
+}
+
+unsigned int CostTable::getSize() const {
+    return size;
+}
+
+unsigned long long CostTable::mix(unsigned long long key) {
+    key ^= key >> 33;
+    key *= 0xff51afd7ed558ccdull;
+    key ^= key >> 33;
+    key *= 0xc4ceb9fe1a85ec53ull;
+    key ^= key >> 33;
+    return key;
+}
+
+unsigned long long CostTable::find(unsigned long long key) const {
+    unsigned long long bucket = mix(key) & mask;
+    while (entries[bucket].used && entries[bucket].key != key)
+        bucket = (bucket + 1) & mask;
+    return bucket;
+}
+
+void CostTable::grow() {
+    std::vector<Entry> old(2 * entries.size());
+    old.swap(entries);
+    mask = entries.size() - 1;
+    for (const Entry &entry : old) {
+        if (entry.used)
+            entries[find(entry.key)] = entry;
+    }
+    hand = 0;
+}
+
+void CostTable::evict() {
+    while (true) {
+        Entry &entry = entries[hand];
+        if (entry.used && !entry.referenced) {
+            erase(hand);
+            return;
+        }
+        entry.referenced = false;
+        hand = static_cast<unsigned int>((hand + 1) & mask);
+    }
+}
+
+void CostTable::erase(unsigned long long bucket) {
+    entries[bucket].used = false;
+    size--;
+    unsigned long long next = bucket;
+    while (true) {
+        next = (next + 1) & mask;
+        if (!entries[next].used)
+            return;
+
+        // The state may only move backwards if the vacated bucket lies between its home bucket and its current one.
+        unsigned long long home = mix(entries[next].key) & mask;
+        if (((next - home) & mask) >= ((next - bucket) & mask)) {
+            entries[bucket] = entries[next];
+            entries[next].used = false;
+            bucket = next;
+        }
+    }
+}
@@ -0,0 +1,86 @@
+#ifndef RATATOSKR_COSTTABLE_H
+#define RATATOSKR_COSTTABLE_H
+
+
+#include <vector>
+
+/**
+ * Represents a sparse store of the costs of visited states. The states are identified by 64-bit keys and kept in an
+ * open-addressing hash table with linear probing, so that only states that have actually been updated occupy memory.
+ * Unknown states have a cost of zero.
+ *
+ * Optionally, the number of stored states can be bounded. As soon as a bounded table is full, a clock sweep evicts a
+ * state that has not been updated since the hand last passed it, i.e. recently updated states get a second chance.
+ *
+ * @author  Felix Voelker
+ * @version 0.1.0
+ * @since   27.1.2018
+ */
+class CostTable {
+
+public:
+    /**
+     * Creates an empty table.
+     * @param capacity Maximum number of stored states, 0 for an unbounded table.
+     */
+    explicit CostTable(unsigned int capacity = 0);
+
+    /**
+     * Returns the cost of a state or zero if the state is not stored.
+     */
+    float get(unsigned long long key) const;
+
+    /**
+     * Stores the cost of a state, evicting another state if the table is bounded and full.
+     */
+    void set(unsigned long long key, float cost);
+
+    bool contains(unsigned long long key) const;
+
+    unsigned int getCapacity() const;
+    unsigned int getSize() const;
+
+private:
+    struct Entry {
+        unsigned long long key = 0;
+        float cost = 0;
+        bool used = false;
+        bool referenced = false;
+    };
+
+    unsigned int capacity;
+    unsigned int size = 0;
+    unsigned int hand = 0;
+    unsigned long long mask;
+    std::vector<Entry> entries;
+
+    /**
+     * Scrambles the bits of a key since packed chromosomes often only differ in a few bits.
+     */
+    static unsigned long long mix(unsigned long long key);
+
+    /**
+     * Returns the bucket that holds the key or the empty bucket that terminates its probe sequence.
+     */
+    unsigned long long find(unsigned long long key) const;
+
+    /**
+     * Doubles the number of buckets and reinserts all stored states.
+     */
+    void grow();
+
+    /**
+     * Removes the next state under the clock hand that has not been referenced since its last pass.
+     */
+    void evict();
+
+    /**
+     * Removes the state of a bucket and shifts the following states of its cluster backwards, so that no probe
+     * sequence is interrupted.
+     */
+    void erase(unsigned long long bucket);
+
+};
+
+
+#endif //RATATOSKR_COSTTABLE_H
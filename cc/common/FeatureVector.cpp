@@ -1,11 +1,60 @@
+#include <algorithm>
 #include "FeatureVector.h"
+#include "BitVectorIndividual.h"
+#include "VectorIndividual.h"
 
-FeatureVector::FeatureVector(const common::Configuration &configuration) : FeatureMap(configuration) {}
+FeatureVector::FeatureVector(const common::Configuration &configuration) : FeatureMap(configuration) {
+    genes = dynamic_cast<const common::Configuration::ProblemConfiguration &>(configuration.getProblemConfiguration()).genes;
+}
 
 std::vector<float> & FeatureVector::compute(std::vector<float> &chromosome) const {
     return chromosome;
 }
 
+unsigned int FeatureVector::getDimension() const {
+    return genes;
+}
+
+void FeatureVector::extract(Individual &individual, float *features) const {
+    auto *bitvector = dynamic_cast<BitVectorIndividual *>(&individual);
+    if (bitvector != nullptr) {
+        std::vector<std::uint64_t> &words = bitvector->getChromosome();
+        unsigned int size = std::min(genes, bitvector->getGenes());
+        for (unsigned int l = 0; l < size; l++)
+            features[l] = static_cast<float>(words[l >> 6] >> (l & 63) & 1);
+    } else {
+        std::vector<float> &chromosome = compute(dynamic_cast<VectorIndividual &>(individual).getChromosome());
+        std::copy(chromosome.begin(), chromosome.begin() + std::min<std::size_t>(genes, chromosome.size()), features);
+    }
+}
+
+void FeatureVector::activate(const std::vector<std::uint64_t> &words,
+                             unsigned int genes,
+                             unsigned int ngram,
+                             std::vector<unsigned long long> &features) const {
+    features.clear();
+    unsigned long long mask = (1ull << ngram) - 1;
+    unsigned long long pattern = 0;
+    for (unsigned int l = 0; l < genes; l++) {
+        pattern = (pattern << 1 | (words[l >> 6] >> (l & 63) & 1)) & mask;
+        if (l + 1 >= ngram)
+            features.push_back(static_cast<unsigned long long>(l + 1 - ngram) << ngram | pattern);
+    }
+}
+
+void FeatureVector::activate(const std::vector<float> &chromosome,
+                             unsigned int ngram,
+                             std::vector<unsigned long long> &features) const {
+    features.clear();
+    unsigned long long mask = (1ull << ngram) - 1;
+    unsigned long long pattern = 0;
+    for (unsigned int l = 0; l < chromosome.size(); l++) {
+        pattern = (pattern << 1 | static_cast<unsigned long long>(chromosome[l] != 0)) & mask;
+        if (l + 1 >= ngram)
+            features.push_back(static_cast<unsigned long long>(l + 1 - ngram) << ngram | pattern);
+    }
+}
+
 FeatureVector * FeatureVector::clone() const {
     return new FeatureVector(*this);
 }
\ No newline at end of file
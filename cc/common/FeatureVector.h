@@ -2,12 +2,14 @@
 #define RATATOSKR_FEATUREVECTOR_H
 
 
+#include <cstdint>
 #include <vector>
 #include "../../core/representation/FeatureMap.h"
 #include "Configuration.h"
 
 /**
- * A simple feature map that performs an identity function on a numerical vector, e.g. a chromosome.
+ * A simple feature map that performs an identity function on a numerical vector, e.g. a chromosome. Alternatively,
+ * it maps a chromosome to the sparse set of its binary n-grams, each of which is tagged with its position.
  *
  * @author  Felix Voelker
  * @version 0.1.0
@@ -23,8 +25,39 @@ public:
      */
     std::vector<float> & compute(std::vector<float> &chromosome) const;
 
+    /**
+     * Returns the number of genes, i.e. each gene becomes a dense feature.
+     */
+    unsigned int getDimension() const override;
+
+    /**
+     * Writes the genes of a bit vector as zeros and ones, whereas a numerical vector is written as is.
+     */
+    void extract(Individual &individual, float *features) const override;
+
+    /**
+     * Computes the active features of a bit vector, i.e. the pattern of each window of n consecutive genes along with
+     * the position of the window. Each feature is encoded as (position << n) | pattern.
+     * @param words    The packed genes of the chromosome, i.e. the k-th gene is the (k mod 64)-th bit of a word.
+     * @param genes    Number of genes in the chromosome.
+     * @param ngram    Number of genes in a window, at most 32.
+     * @param features The active features, one per window.
+     */
+    void activate(const std::vector<std::uint64_t> &words,
+                  unsigned int genes,
+                  unsigned int ngram,
+                  std::vector<unsigned long long> &features) const;
+
+    /**
+     * Computes the active features of a numerical vector, whose non-zero values are regarded as set genes.
+     */
+    void activate(const std::vector<float> &chromosome, unsigned int ngram, std::vector<unsigned long long> &features) const;
+
     FeatureVector * clone() const override;
-    
+
+private:
+    unsigned int genes;
+
 };
 
 
@@ -6,7 +6,65 @@ FitnessProportionateSelection::FitnessProportionateSelection(const common::Confi
     this->epochs = configuration.getEvolutionarySystemConfiguration().epochs;
 }
 
+void FitnessProportionateSelection::prepare(Population &pop) {
+    const std::vector<float> &costs = pop.getCosts();
+    const std::vector<float> &fitnesses = pop.getFitnesses();
+    const std::vector<float> &fractions = pop.getFractions();
+
+    auto size = static_cast<unsigned int>(costs.size());
+    std::vector<double> scaled(size);
+    double total = 0;
+    for (unsigned int k = 0; k < size; k++) {
+        scaled[k] = 1 / (1 + (1 - fractions[k]) * fitnesses[k] + fractions[k] * costs[k]);
+        total += scaled[k];
+    }
+
+    std::vector<unsigned int> small;
+    std::vector<unsigned int> large;
+    for (unsigned int k = 0; k < size; k++) {
+        scaled.at(k) = total > 0 ? scaled.at(k) * size / total : 1;
+        if (scaled.at(k) < 1) {
+            small.push_back(k);
+        } else {
+            large.push_back(k);
+        }
+    }
+
+    probabilities.assign(size, 1);
+    aliases.resize(size);
+    for (unsigned int k = 0; k < size; k++)
+        aliases.at(k) = k;
+
+    while (!small.empty() && !large.empty()) {
+        unsigned int less = small.back();
+        unsigned int more = large.back();
+        small.pop_back();
+
+        probabilities.at(less) = static_cast<float>(scaled.at(less));
+        aliases.at(less) = more;
+        scaled.at(more) = scaled.at(more) + scaled.at(less) - 1;
+        if (scaled.at(more) < 1) {
+            large.pop_back();
+            small.push_back(more);
+        }
+    }
+}
+
+void FitnessProportionateSelection::finish(Population &pop) {
+    std::vector<float>().swap(probabilities);
+    std::vector<unsigned int>().swap(aliases);
+}
+
 Individual * FitnessProportionateSelection::select(std::vector<Individual *> &parents, Thread &thread) const {
+    if (!probabilities.empty() && probabilities.size() == parents.size()) {
+        unsigned int column = thread.random.sampleIntFromUniformDistribution(static_cast<unsigned int>(parents.size()));
+        if (thread.random.sample() < probabilities.at(column)) {
+            return parents.at(column);
+        } else {
+            return parents.at(aliases.at(column));
+        }
+    }
+
     std::vector<float> relevances(parents.size());
     for (int k = 0; k < parents.size(); k++) {
         relevances.at(k) = parents.at(k)->getRelevance().adjustedRelevance();
@@ -2,11 +2,14 @@
 #define RATATOSKR_FITNESSPROPORTIONATESELECTION_H
 
 
+#include <vector>
 #include "../../core/variation/SelectionOperator.h"
 #include "Configuration.h"
 
 /**
- * A roulette wheel selection operator as commonly used in Neuro-Dynamic Evolutionary Algorithms (NDEAs).
+ * A roulette wheel selection operator as commonly used in Neuro-Dynamic Evolutionary Algorithms (NDEAs). The wheel is
+ * built once per generation as an alias table as described in "Michael D. Vose. A Linear Algorithm For Generating
+ * Random Numbers With a Given Distribution (1991)", thus each selection takes constant time.
  *
  * @author  Felix Voelker
  * @version 0.1.0
@@ -17,9 +20,20 @@ class FitnessProportionateSelection : public SelectionOperator {
 public:
     explicit FitnessProportionateSelection(const common::Configuration &configuration);
 
+    /**
+     * Builds the alias table of the adjusted relevances by scanning the population's relevance arrays.
+     */
+    void prepare(Population &pop) override;
+
+    /**
+     * Discards the alias table, since the relevances it has been built from change with the next generation.
+     */
+    void finish(Population &pop) override;
+
     /**
      * Samples an individual based on a relevance dependent probability distribution whose fraction is determined by
-     * an alignment strategy over the number of epochs, i.e. fraction = current epoch / total epochs.
+     * an alignment strategy over the number of epochs, i.e. fraction = current epoch / total epochs. If the alias
+     * table has not been prepared for the current generation, the distribution is computed from scratch.
      */
     Individual * select(std::vector<Individual *> &parents, Thread &thread) const override;
 
@@ -28,6 +42,10 @@ public:
 protected:
     unsigned int epochs;
 
+    /** The alias table, i.e. the probability of keeping each column and the index of its alias otherwise. */
+    std::vector<float> probabilities;
+    std::vector<unsigned int> aliases;
+
     FitnessProportionateSelection(const FitnessProportionateSelection &obj);
 
 };
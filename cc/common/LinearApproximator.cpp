@@ -0,0 +1,107 @@
+#include <iostream>
+#include "LinearApproximator.h"
+#include "BitVectorIndividual.h"
+#include "FeatureVector.h"
+#include "VectorIndividual.h"
+
+const unsigned int LinearApproximator::MAX_NGRAM;
+const unsigned int LinearApproximator::MAX_BITS;
+
+LinearApproximator::LinearApproximator(const common::Configuration &configuration)
+        : EvolutionaryNetwork(configuration),
+          bits(configuration.getLinearApproximatorConfiguration().bits),
+          ngram(configuration.getLinearApproximatorConfiguration().ngram),
+          bias(0)
+{
+    try {
+        if (ngram < 1 || ngram > MAX_NGRAM) {
+            std::string error_message = "Number of genes per feature is out of range.";
+            error_message += " Actual: " + std::to_string(ngram);
+            error_message += " Expected: 1 to " + std::to_string(MAX_NGRAM) + ".";
+            throw ConfigurationException(error_message);
+        }
+        if (bits > MAX_BITS) {
+            std::string error_message = "Number of bits of the hashed features is out of range.";
+            error_message += " Actual: " + std::to_string(bits);
+            error_message += " Expected: at most " + std::to_string(MAX_BITS) + ".";
+            throw ConfigurationException(error_message);
+        }
+    } catch (ConfigurationException &e) {
+        std::cout << e.what() << std::endl;
+        exit(1);
+    }
+
+    weights.assign(1ull << bits, 0);
+}
+
+std::vector<float> LinearApproximator::output(std::vector<Individual *> &individuals) const {
+    std::vector<float> costs(individuals.size());
+    std::vector<unsigned long long> indices;
+    for (unsigned int k = 0; k < individuals.size(); k++) {
+        activate(*individuals.at(k), indices);
+        costs.at(k) = evaluate(indices);
+    }
+    return costs;
+}
+
+void LinearApproximator::update(std::vector<Individual *> &parents, std::vector<Individual *> &offsprings) {
+    for (unsigned int k = 0; k < parents.size(); k++) {
+        float fitness = parents.at(k)->getRelevance().getFitness();
+        if (fitness <= 0)
+            continue;
+
+        activate(*offsprings.at(k), active);
+        float postcost = evaluate(active);
+        activate(*parents.at(k), active);
+        float precost = evaluate(active);
+
+        float step = learning_rate * (fitness + discount_factor * postcost - precost) / (active.size() + 1);
+        for (auto index : active)
+            weights[index] += step;
+        bias += step;
+    }
+}
+
+LinearApproximator * LinearApproximator::clone() const {
+    return new LinearApproximator(*this);
+}
+
+LinearApproximator::LinearApproximator(const LinearApproximator &obj)
+        : EvolutionaryNetwork(obj),
+          bits(obj.bits),
+          ngram(obj.ngram),
+          weights(obj.weights),
+          bias(obj.bias) {}
+
+std::vector<unsigned long long> LinearApproximator::preprocess(std::vector<Individual *> &individuals) const {
+    std::vector<unsigned long long> indices;
+    std::vector<unsigned long long> features;
+    for (auto *individual : individuals) {
+        activate(*individual, features);
+        indices.insert(indices.end(), features.begin(), features.end());
+    }
+    return indices;
+}
+
+void LinearApproximator::activate(Individual &individual, std::vector<unsigned long long> &indices) const {
+    auto &featurevector = dynamic_cast<FeatureVector &>(individual.getFeaturemap());
+    auto *bitvector = dynamic_cast<BitVectorIndividual *>(&individual);
+    if (bitvector != nullptr)
+        featurevector.activate(bitvector->getChromosome(), bitvector->getGenes(), ngram, indices);
+    else
+        featurevector.activate(dynamic_cast<VectorIndividual &>(individual).getChromosome(), ngram, indices);
+
+    // Fibonacci hashing spreads the structured features over the upper bits of the product.
+    for (auto &index : indices)
+        index = bits == 0 ? 0 : index * 0x9e3779b97f4a7c15ull >> (64 - bits);
+}
+
+float LinearApproximator::evaluate(const std::vector<unsigned long long> &indices) const {
+    float cost = bias;
+    for (auto index : indices)
+        cost += weights[index];
+    return cost;
+}
+
+LinearApproximator::ConfigurationException::ConfigurationException(std::string error_message)
+        : runtime_error(error_message) {}
@@ -0,0 +1,93 @@
+#ifndef RATATOSKR_LINEARAPPROXIMATOR_H
+#define RATATOSKR_LINEARAPPROXIMATOR_H
+
+
+#include <stdexcept>
+#include "../../core/experience/EvolutionaryNetwork.h"
+#include "Configuration.h"
+
+/**
+ * Represents an evolutionary network that approximates the costs linearly in sparse binary features, i.e. the cost of
+ * an individual is the sum of the weights of its active features. The features are the position-tagged n-grams of the
+ * chromosome as given by its feature vector, which are hashed into a fixed number of weights as described in "Kilian
+ * Weinberger et al.: Feature Hashing for Large Scale Multitask Learning (2009)." Overlapping n-grams act like tilings
+ * of the chromosome, hence the approximator generalizes over chromosomes that share some windows of genes.
+ *
+ * Accordingly, its memory does not depend on the number of genes, whereas estimating and updating an individual only
+ * touches its active features. The update is the normalized TD(0) rule, i.e. the temporal difference error is spread
+ * evenly over the active features, so that the step size does not depend on the number of features either.
+ *
+ * @author  Felix Voelker
+ * @version 0.1.0
+ * @since   27.1.2018
+ */
+class LinearApproximator : public EvolutionaryNetwork {
+
+public:
+    /**
+     * Denotes the largest number of genes per feature, since the pattern of a window is encoded in the lower half of
+     * a feature.
+     */
+    static const unsigned int MAX_NGRAM = 32;
+
+    /**
+     * Denotes the largest number of bits of the hashed features, i.e. the approximator holds at most 2^30 weights.
+     */
+    static const unsigned int MAX_BITS = 30;
+
+    /**
+     * Creates the approximator with 2^bits weights for features of ngram consecutive genes.
+     * @throws ConfigurationException if ngram is not within [1, MAX_NGRAM] or bits exceeds MAX_BITS.
+     */
+    explicit LinearApproximator(const common::Configuration &configuration);
+
+    std::vector<float> output(std::vector<Individual *> &individuals) const override;
+    void update(std::vector<Individual *> &parents, std::vector<Individual *> &offsprings) override;
+
+    LinearApproximator * clone() const override;
+
+protected:
+    LinearApproximator(const LinearApproximator &obj);
+
+    /**
+     * Hashes the active features of each individual into the indices of their weights, which are concatenated.
+     */
+    std::vector<unsigned long long> preprocess(std::vector<Individual *> &individuals) const override;
+
+    /**
+     * An exception that is thrown if the approximator is configured with out of range parameters.
+     *
+     * @author  Felix Voelker
+     * @version 0.1.0
+     * @since   27.1.2018
+     */
+    class ConfigurationException : public std::runtime_error {
+
+    public:
+        explicit ConfigurationException(std::string error_message);
+
+    };
+
+private:
+    unsigned int bits;
+    unsigned int ngram;
+    std::vector<float> weights;
+    float bias;
+
+    /** The hashed features of the last individual, which are reused by the update. */
+    std::vector<unsigned long long> active;
+
+    /**
+     * Writes the indices of the weights of an individual's active features.
+     */
+    void activate(Individual &individual, std::vector<unsigned long long> &indices) const;
+
+    /**
+     * Sums up the weights of the given indices.
+     */
+    float evaluate(const std::vector<unsigned long long> &indices) const;
+
+};
+
+
+#endif //RATATOSKR_LINEARAPPROXIMATOR_H
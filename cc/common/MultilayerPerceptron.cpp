@@ -0,0 +1,180 @@
+#include <algorithm>
+#include <cmath>
+#include "MultilayerPerceptron.h"
+#include "../../core/util/Philox.h"
+
+const unsigned int MultilayerPerceptron::BLOCK = 16;
+
+MultilayerPerceptron::MultilayerPerceptron(const common::Configuration &configuration)
+        : EvolutionaryNetwork(configuration),
+          inputs(dynamic_cast<const common::Configuration::ProblemConfiguration &>(configuration.getProblemConfiguration()).genes),
+          hidden(configuration.getMultilayerPerceptronConfiguration().hidden),
+          hidden_weights(inputs, hidden),
+          hidden_biases(hidden, 0),
+          output_weights(hidden, 0),
+          output_bias(0)
+{
+    // The weights are drawn uniformly with the variance of "Kaiming He et al.: Delving Deep into Rectifiers (2015)."
+    Philox generator(configuration.getEvolutionarySystemConfiguration().seed);
+    auto uniform = [&generator](float limit) {
+        return limit * (2 * ((generator() >> 8) * (1.0f / 16777216.0f)) - 1);
+    };
+    float limit = std::sqrt(6.0f / std::max(inputs, 1u));
+    for (unsigned int l = 0; l < inputs; l++) {
+        float *weights = hidden_weights.row(l);
+        for (unsigned int j = 0; j < hidden; j++)
+            weights[j] = uniform(limit);
+    }
+    limit = std::sqrt(3.0f / std::max(hidden, 1u));
+    for (auto &weight : output_weights)
+        weight = uniform(limit);
+}
+
+std::vector<float> MultilayerPerceptron::output(std::vector<Individual *> &individuals) const {
+    std::vector<float> costs(individuals.size());
+    Matrix features;
+    Matrix activations(individuals.size(), hidden);
+    if (!individuals.empty())
+        individuals.at(0)->getFeaturemap().extractBatch(individuals, 0, static_cast<unsigned int>(individuals.size()), features);
+    forward(features, activations, costs.data());
+    return costs;
+}
+
+void MultilayerPerceptron::estimate(std::vector<Individual *> &individuals, unsigned int onset, unsigned int offset) const {
+    std::vector<float> costs(offset);
+    Matrix features;
+    Matrix activations(offset, hidden);
+    if (offset > 0)
+        individuals.at(onset)->getFeaturemap().extractBatch(individuals, onset, offset, features);
+    forward(features, activations, costs.data());
+    for (unsigned int k = 0; k < offset; k++)
+        individuals.at(onset + k)->getRelevance().setCost(costs.at(k));
+}
+
+void MultilayerPerceptron::update(std::vector<Individual *> &parents, std::vector<Individual *> &offsprings) {
+    auto size = static_cast<unsigned int>(parents.size());
+    if (size == 0)
+        return;
+
+    std::vector<float> precosts(size);
+    std::vector<float> postcosts(size);
+    parent_activations.resize(size, hidden);
+    offspring_activations.resize(size, hidden);
+    FeatureMap &featuremap = parents.at(0)->getFeaturemap();
+    if (pool != nullptr) {
+        featuremap.extractBatch(parents, parent_features, *pool);
+        featuremap.extractBatch(offsprings, offspring_features, *pool);
+    } else {
+        featuremap.extractBatch(parents, 0, size, parent_features);
+        featuremap.extractBatch(offsprings, 0, size, offspring_features);
+    }
+    forward(parent_features, parent_activations, precosts.data());
+    forward(offspring_features, offspring_activations, postcosts.data());
+
+    std::vector<float> errors(size, 0);
+    for (unsigned int k = 0; k < size; k++) {
+        float fitness = parents.at(k)->getRelevance().getFitness();
+        if (fitness > 0)
+            errors.at(k) = fitness + discount_factor * postcosts.at(k) - precosts.at(k);
+    }
+    backward(parent_features, parent_activations, errors);
+}
+
+MultilayerPerceptron * MultilayerPerceptron::clone() const {
+    return new MultilayerPerceptron(*this);
+}
+
+MultilayerPerceptron::MultilayerPerceptron(const MultilayerPerceptron &obj)
+        : EvolutionaryNetwork(obj),
+          inputs(obj.inputs),
+          hidden(obj.hidden),
+          hidden_weights(obj.hidden_weights),
+          hidden_biases(obj.hidden_biases),
+          output_weights(obj.output_weights),
+          output_bias(obj.output_bias) {}
+
+std::vector<unsigned long long> MultilayerPerceptron::preprocess(std::vector<Individual *> &individuals) const {
+    return std::vector<unsigned long long>();
+}
+
+void MultilayerPerceptron::forward(const Matrix &features, Matrix &activations, float *costs) const {
+    std::size_t rows = features.getRows();
+    std::size_t columns = std::min<std::size_t>(inputs, features.getColumns());
+    for (std::size_t onset = 0; onset < rows; onset += BLOCK) {
+        std::size_t end = std::min<std::size_t>(rows, onset + BLOCK);
+        for (std::size_t i = onset; i < end; i++)
+            std::copy(hidden_biases.begin(), hidden_biases.end(), activations.row(i));
+
+        // Each row of the weights is loaded once per block and applied to all of its rows while they reside in cache.
+        for (unsigned int l = 0; l < columns; l++) {
+            const float *weights = hidden_weights.row(l);
+            for (std::size_t i = onset; i < end; i++) {
+                float x = features.row(i)[l];
+                if (x == 0)
+                    continue;
+                float *activation = activations.row(i);
+                for (unsigned int j = 0; j < hidden; j++)
+                    activation[j] += x * weights[j];
+            }
+        }
+
+        for (std::size_t i = onset; i < end; i++) {
+            float *activation = activations.row(i);
+            float cost = output_bias;
+            for (unsigned int j = 0; j < hidden; j++) {
+                activation[j] = std::max(activation[j], 0.0f);
+                cost += activation[j] * output_weights[j];
+            }
+            costs[i] = cost;
+        }
+    }
+}
+
+void MultilayerPerceptron::backward(const Matrix &features, const Matrix &activations, const std::vector<float> &errors) {
+    std::size_t rows = features.getRows();
+    std::size_t columns = std::min<std::size_t>(inputs, features.getColumns());
+    if (rows == 0)
+        return;
+
+    // The gradients of the hidden units are taken before the output weights move.
+    float step = learning_rate / rows;
+    gradients.resize(rows, hidden);
+    for (std::size_t i = 0; i < rows; i++) {
+        float error = errors.at(i);
+        if (error == 0)
+            continue;
+        const float *activation = activations.row(i);
+        float *gradient = gradients.row(i);
+        for (unsigned int j = 0; j < hidden; j++)
+            gradient[j] = activation[j] > 0 ? error * output_weights[j] : 0;
+    }
+
+    for (std::size_t i = 0; i < rows; i++) {
+        float error = errors.at(i);
+        const float *activation = activations.row(i);
+        for (unsigned int j = 0; j < hidden; j++)
+            output_weights[j] += step * error * activation[j];
+        output_bias += step * error;
+    }
+
+    for (std::size_t onset = 0; onset < rows; onset += BLOCK) {
+        std::size_t end = std::min<std::size_t>(rows, onset + BLOCK);
+        for (unsigned int l = 0; l < columns; l++) {
+            float *weights = hidden_weights.row(l);
+            for (std::size_t i = onset; i < end; i++) {
+                float x = features.row(i)[l];
+                if (x == 0 || errors.at(i) == 0)
+                    continue;
+                const float *gradient = gradients.row(i);
+                for (unsigned int j = 0; j < hidden; j++)
+                    weights[j] += step * x * gradient[j];
+            }
+        }
+    }
+
+    for (std::size_t i = 0; i < rows; i++) {
+        const float *gradient = gradients.row(i);
+        for (unsigned int j = 0; j < hidden; j++)
+            hidden_biases[j] += step * gradient[j];
+    }
+}
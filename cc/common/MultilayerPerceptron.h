@@ -0,0 +1,84 @@
+#ifndef RATATOSKR_MULTILAYERPERCEPTRON_H
+#define RATATOSKR_MULTILAYERPERCEPTRON_H
+
+
+#include "../../core/experience/EvolutionaryNetwork.h"
+#include "../../core/util/Matrix.h"
+#include "Configuration.h"
+
+/**
+ * Represents an evolutionary network that approximates the costs by a multilayer perceptron with a single hidden layer
+ * of rectified linear units, i.e. cost(x) = w2 * max(0, W1 * x + b1) + b2 for the features x of an individual. Unlike
+ * a transition table, the perceptron generalizes over unvisited chromosomes and slots, while its size only grows
+ * linearly with the number of genes.
+ *
+ * The features of a whole batch of individuals are extracted by their feature map into a row-major matrix, which is
+ * split over the attached pool for whole generations. Thus, the forward and backward passes run as blocked matrix
+ * products. A block of rows stays in the cache while the weights are streamed once per block, and each inner loop runs
+ * with unit stride over aligned rows, thus it is vectorized by the compiler without any external BLAS. The features
+ * of the individuals are expected to be given by a feature vector or any other map of one feature per gene. The
+ * perceptron is trained by TD(0), i.e. the cost of each parent is moved towards its fitness plus the discounted cost
+ * of its offspring by a gradient step on the squared temporal difference error.
+ *
+ * @author  Felix Voelker
+ * @version 0.1.0
+ * @since   27.1.2018
+ */
+class MultilayerPerceptron : public EvolutionaryNetwork {
+
+public:
+    explicit MultilayerPerceptron(const common::Configuration &configuration);
+
+    std::vector<float> output(std::vector<Individual *> &individuals) const override;
+
+    /**
+     * Runs the forward pass on the features of the range only.
+     */
+    void estimate(std::vector<Individual *> &individuals, unsigned int onset, unsigned int offset) const override;
+
+    void update(std::vector<Individual *> &parents, std::vector<Individual *> &offsprings) override;
+
+    MultilayerPerceptron * clone() const override;
+
+protected:
+    MultilayerPerceptron(const MultilayerPerceptron &obj);
+
+    /**
+     * The perceptron does not key the individuals, since it consumes their features as a matrix instead.
+     */
+    std::vector<unsigned long long> preprocess(std::vector<Individual *> &individuals) const override;
+
+private:
+    /** The number of rows that are processed at once by the kernels. */
+    static const unsigned int BLOCK;
+
+    unsigned int inputs;
+    unsigned int hidden;
+
+    /** The weights of the hidden layer, one row per input, and the weights of the output unit. */
+    Matrix hidden_weights;
+    std::vector<float> hidden_biases;
+    std::vector<float> output_weights;
+    float output_bias;
+
+    /** The buffers of the update, which are reused at each generation. */
+    Matrix parent_features;
+    Matrix parent_activations;
+    Matrix offspring_features;
+    Matrix offspring_activations;
+    Matrix gradients;
+
+    /**
+     * Computes the activations of the hidden layer and the costs for each row of the features.
+     */
+    void forward(const Matrix &features, Matrix &activations, float *costs) const;
+
+    /**
+     * Performs a gradient step on the squared errors of the rows, where the activations stem from the forward pass.
+     */
+    void backward(const Matrix &features, const Matrix &activations, const std::vector<float> &errors);
+
+};
+
+
+#endif //RATATOSKR_MULTILAYERPERCEPTRON_H
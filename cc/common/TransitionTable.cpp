@@ -1,57 +1,131 @@
 #include "TransitionTable.h"
 #include "Problem.h"
+#include "BitVectorIndividual.h"
 #include "VectorIndividual.h"
 
 TransitionTable::TransitionTable(const common::Configuration &configuration) :
         EvolutionaryNetwork(configuration),
-        lookup_table(std::vector<std::vector<float>>(
+        lookup_table(std::vector<CostTable>(
                 configuration.getProblemConfiguration().popsize,
-                std::vector<float>(static_cast<unsigned long>(
-                                           pow(2, dynamic_cast<const common::Configuration::ProblemConfiguration &>(
-                                                   configuration.getProblemConfiguration()).genes)), 0)) )
+                CostTable(configuration.getTransitionTableConfiguration().capacity))),
+        keys(configuration.getProblemConfiguration().popsize, 0),
+        keyed(configuration.getProblemConfiguration().popsize, nullptr)
 {
 }
 
 std::vector<float> TransitionTable::output(std::vector<Individual *> &individuals) const {
-    std::vector<float> cost = std::vector<float>(lookup_table.size());
-    std::vector<unsigned int> indices = preprocess(individuals);
+    std::vector<float> cost = std::vector<float>(individuals.size());
+    std::vector<unsigned long long> keys = preprocess(individuals);
     for (unsigned int k = 0; k < individuals.size(); k++) {
-        cost.at(k) = lookup_table.at(k).at(indices.at(k));
+        cost.at(k) = lookup_table.at(k).get(keys.at(k));
     }
     return cost;
 }
 
+void TransitionTable::estimate(std::vector<Individual *> &individuals, unsigned int onset, unsigned int offset) const {
+    for (unsigned int k = onset; k < onset + offset; k++) {
+        Individual &individual = *individuals.at(k);
+        keys.at(k) = pack(individual);
+        keyed.at(k) = &individual;
+        individual.getRelevance().setCost(lookup_table.at(k).get(keys.at(k)));
+    }
+}
+
 void TransitionTable::update(std::vector<Individual *> &parents, std::vector<Individual *> &offsprings) {
-    std::vector<unsigned int> parent_indices = preprocess(parents);
-    std::vector<unsigned int> offspring_indices = preprocess(offsprings);
+    updateChunk(parents, offsprings, 0, static_cast<unsigned int>(lookup_table.size()));
+}
+
+bool TransitionTable::isPartitioned() const {
+    return true;
+}
 
-    for (unsigned int k = 0; k < lookup_table.size(); k++) {
-        float precost = lookup_table.at(k).at(parent_indices.at(k));
-        float postcost = lookup_table.at(k).at(offspring_indices.at(k));
-        float fitness = parents.at(k)->getRelevance().getFitness();
+void TransitionTable::updateChunk(std::vector<Individual *> &parents,
+                                  std::vector<Individual *> &offsprings,
+                                  unsigned int onset,
+                                  unsigned int offset) {
+    for (unsigned int k = onset; k < onset + offset; k++) {
+        unsigned long long parent_key = keyed.at(k) == parents.at(k) ? keys.at(k) : pack(*parents.at(k));
+        learn(k, parent_key, pack(*offsprings.at(k)), parents.at(k)->getRelevance().getFitness());
+    }
+}
+
+bool TransitionTable::record(std::vector<Individual *> &parents,
+                             std::vector<Individual *> &offsprings,
+                             std::vector<Transition> &transitions) const {
+    transitions.resize(parents.size());
+    for (unsigned int k = 0; k < parents.size(); k++) {
+        Transition &transition = transitions.at(k);
+        transition.state = keyed.at(k) == parents.at(k) ? keys.at(k) : pack(*parents.at(k));
+        transition.next = pack(*offsprings.at(k));
+        transition.fitness = parents.at(k)->getRelevance().getFitness();
+        transition.slot = k;
+    }
+    return true;
+}
 
-        if (fitness > 0)
-            lookup_table.at(k).at(parent_indices.at(k)) = precost + learning_rate * (fitness + discount_factor * postcost - precost);
+void TransitionTable::learn(const std::vector<Transition> &transitions, std::vector<float> &errors) {
+    errors.resize(transitions.size());
+    for (unsigned long k = 0; k < transitions.size(); k++) {
+        const Transition &transition = transitions.at(k);
+        errors.at(k) = learn(transition.slot, transition.state, transition.next, transition.fitness);
     }
 }
 
+float TransitionTable::learn(unsigned int slot, unsigned long long state, unsigned long long next, float fitness) {
+    if (fitness <= 0)
+        return 0;
+
+    float precost = lookup_table.at(slot).get(state);
+    float postcost = lookup_table.at(slot).get(next);
+    float error = fitness + discount_factor * postcost - precost;
+    lookup_table.at(slot).set(state, precost + learning_rate * error);
+    return error;
+}
+
 EvolutionaryNetwork* TransitionTable::clone() const {
     return new TransitionTable(*this);
 }
 
 TransitionTable::TransitionTable(const TransitionTable &obj) : EvolutionaryNetwork(obj) {
-    this->lookup_table = std::vector<std::vector<float>>(obj.lookup_table);
+    this->lookup_table = std::vector<CostTable>(obj.lookup_table);
+    this->keys = std::vector<unsigned long long>(obj.keys.size(), 0);
+    this->keyed = std::vector<const Individual *>(obj.keyed.size(), nullptr);
 }
 
-std::vector<unsigned int> TransitionTable::preprocess(std::vector<Individual *> &individuals) const {
-    auto indices = std::vector<unsigned int>(individuals.size());
+std::vector<unsigned long long> TransitionTable::preprocess(std::vector<Individual *> &individuals) const {
+    auto keys = std::vector<unsigned long long>(individuals.size());
     for (unsigned int k = 0; k < individuals.size(); k++) {
-        std::vector<float> &chromosome = dynamic_cast<VectorIndividual *>(individuals.at(k))->getChromosome();
-        unsigned int index = 0;
+        keys.at(k) = pack(*individuals.at(k));
+    }
+    return keys;
+}
+
+unsigned long long TransitionTable::pack(Individual &individual) {
+    unsigned long long key = 0;
+    auto *bitvector = dynamic_cast<BitVectorIndividual *>(&individual);
+    if (bitvector != nullptr) {
+        std::vector<std::uint64_t> &words = bitvector->getChromosome();
+        key = words.size() == 1 ? words.at(0) : 0;
+        for (unsigned int l = 0; words.size() > 1 && l < words.size(); l++) {
+            key = fold(key, words.at(l));
+        }
+    } else {
+        std::vector<float> &chromosome = dynamic_cast<VectorIndividual &>(individual).getChromosome();
+        unsigned long long word = 0;
         for (unsigned int l = 0; l < chromosome.size(); l++) {
-            index += chromosome.at(l) * pow(2, chromosome.size() - l -1);
+            word |= static_cast<unsigned long long>(chromosome.at(l) != 0) << (l % 64);
+            if (chromosome.size() > 64 && (l % 64 == 63 || l == chromosome.size() - 1)) {
+                key = fold(key, word);
+                word = 0;
+            }
         }
-        indices.at(k) = index;
+        if (chromosome.size() <= 64)
+            key = word;
     }
-    return indices;
-}
\ No newline at end of file
+    return key;
+}
+
+unsigned long long TransitionTable::fold(unsigned long long key, unsigned long long word) {
+    key = (key ^ word) * 0x9e3779b97f4a7c15ull;
+    return key ^ key >> 32;
+}
@@ -4,8 +4,13 @@
 
 #include "../../core/experience/EvolutionaryNetwork.h"
 #include "Configuration.h"
+#include "CostTable.h"
 
 /**
+ * Represents a tabular evolutionary network that stores the cost of each visited chromosome per slot of the
+ * population. The chromosomes are packed into 64-bit keys, so that only visited states are materialized in a sparse
+ * cost table instead of a dense table of all 2^genes states.
+ *
  * @author  FelixVoelker
  * @version 0.1.0
  * @since   25.1.2018
@@ -16,16 +21,66 @@ public:
     explicit TransitionTable(const common::Configuration &configuration);
 
     std::vector<float> output(std::vector<Individual *> &individuals) const override;
+
+    /**
+     * Looks up the cost of each individual within the range in the cost table of its slot.
+     */
+    void estimate(std::vector<Individual *> &individuals, unsigned int onset, unsigned int offset) const override;
+
     void update(std::vector<Individual *> &parents, std::vector<Individual *> &offsprings) override;
 
+    /**
+     * Each slot owns its cost table, thus distinct ranges of slots are updated concurrently.
+     */
+    bool isPartitioned() const override;
+
+    /**
+     * Updates the cost tables of the slots within the range. The key of each parent is reused from its last estimate
+     * if the parent has not been replaced since, hence a parent must not be modified between estimation and update.
+     */
+    void updateChunk(std::vector<Individual *> &parents,
+                     std::vector<Individual *> &offsprings,
+                     unsigned int onset,
+                     unsigned int offset) override;
+
+    /**
+     * Records the keys of each parent and offspring along with the parent's fitness, reusing the estimated keys.
+     */
+    bool record(std::vector<Individual *> &parents,
+                std::vector<Individual *> &offsprings,
+                std::vector<Transition> &transitions) const override;
+
+    /**
+     * Applies the same update rule as update to each replayed transition in the cost table of its slot.
+     */
+    void learn(const std::vector<Transition> &transitions, std::vector<float> &errors) override;
+
     EvolutionaryNetwork * clone() const override;
 
 protected:
-    std::vector<std::vector<float>> lookup_table;
+    std::vector<CostTable> lookup_table;
+
+    /** The key of the last estimated individual per slot. */
+    mutable std::vector<unsigned long long> keys;
+    mutable std::vector<const Individual *> keyed;
 
     TransitionTable(const TransitionTable &obj);
 
-    std::vector<unsigned int> preprocess(std::vector<Individual *> &individuals) const override;
+    /**
+     * Packs the binary chromosomes into keys, i.e. the k-th gene becomes the (k mod 64)-th bit. Chromosomes with more
+     * than 64 genes are folded word by word into a hashed key.
+     */
+    std::vector<unsigned long long> preprocess(std::vector<Individual *> &individuals) const override;
+
+private:
+    /**
+     * Moves the cost of a state towards the fitness plus the discounted cost of its successor.
+     * @return The temporal difference error of the transition, which is zero if the state is ideal.
+     */
+    float learn(unsigned int slot, unsigned long long state, unsigned long long next, float fitness);
+
+    static unsigned long long pack(Individual &individual);
+    static unsigned long long fold(unsigned long long key, unsigned long long word);
 
 };
 
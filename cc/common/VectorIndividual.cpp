@@ -1,3 +1,5 @@
+#include <cstdint>
+#include <cstring>
 #include <iostream>
 #include "VectorIndividual.h"
 
@@ -57,6 +59,27 @@ VectorIndividual * VectorIndividual::clone() const {
     return new VectorIndividual(*this);
 }
 
+bool VectorIndividual::assign(const Individual &obj) {
+    auto *other = dynamic_cast<const VectorIndividual *>(&obj);
+    if (other == nullptr)
+        return false;
+
+    assignState(obj);
+    this->chromosome.assign(other->chromosome.begin(), other->chromosome.end());
+    return true;
+}
+
+bool VectorIndividual::hash(unsigned long long &key) const {
+    key = chromosome.size();
+    for (float gene : chromosome) {
+        std::uint32_t bits;
+        std::memcpy(&bits, &gene, sizeof(bits));
+        key = (key ^ bits) * 0x9e3779b97f4a7c15ull;
+        key ^= key >> 32;
+    }
+    return true;
+}
+
 std::vector<float> & VectorIndividual::getChromosome() {
     return chromosome;
 }
@@ -31,6 +31,10 @@ public:
 
     VectorIndividual * clone() const override;
 
+    bool assign(const Individual &obj) override;
+
+    bool hash(unsigned long long &key) const override;
+
     std::vector<float> & getChromosome();
 
 protected:
@@ -14,6 +14,7 @@ int main() {
     session->getConfiguration().getEvolutionarySystemConfiguration().generations = 50;
     session->getConfiguration().getEvaluatorConfiguration().threads = 3;
     session->getConfiguration().getBreederConfiguration().threads = 3;
+    session->getConfiguration().getReplayerConfiguration().threads = 3;
     session->getConfiguration().getInitializerConfiguration().threads = 3;
     auto *system = session->build();
     system->run();
@@ -1,5 +1,5 @@
 #include "BitVectorCrossover.h"
-#include "../common/VectorIndividual.h"
+#include "../common/BitVectorIndividual.h"
 
 BitVectorCrossover::BitVectorCrossover(const common::Configuration &configuration) : BreedingOperator(configuration) {
     this->pc = configuration.getCrossoverConfiguration().xover_rate;
@@ -16,22 +16,51 @@ BitVectorCrossover::BitVectorCrossover(const BitVectorCrossover &obj) : Breeding
 unsigned long BitVectorCrossover::expectedSources() const { return 2; }
 
 std::vector<Individual *> & BitVectorCrossover::breed(std::vector<Individual *> &parents, Thread &thread) const {
-    auto *parent1 = dynamic_cast<VectorIndividual *>(parents.at(0));
-    auto *parent2 = dynamic_cast<VectorIndividual *>(parents.at(1));
+    cross(parents, true, thread);
+    return parents;
+}
+
+unsigned long BitVectorCrossover::demand(unsigned long needed) const {
+    return needed < 2 ? 1 : 2;
+}
+
+std::vector<Individual *> & BitVectorCrossover::breedExactly(std::vector<Individual *> &parents,
+                                                             unsigned long needed,
+                                                             Thread &thread) const {
+    cross(parents, needed >= 2, thread);
+    if (needed < parents.size())
+        parents.resize(needed);
+    return parents;
+}
+
+void BitVectorCrossover::cross(std::vector<Individual *> &parents, bool both, Thread &thread) const {
+    auto *parent1 = dynamic_cast<BitVectorIndividual *>(parents.at(0));
+    auto *parent2 = dynamic_cast<BitVectorIndividual *>(parents.at(1));
 
     if (thread.random.sample() < pc) {
-        auto genes = static_cast<unsigned int>(parent1->getChromosome().size());
+        unsigned int genes = parent1->getGenes();
         unsigned int xover_point = thread.random.sampleIntFromUniformDistribution(genes);
 
-        for (unsigned int k = xover_point + 1; k < genes; k++) {
-            float gene = parent1->getChromosome().at(k);
-            parent1->getChromosome().at(k) = parent2->getChromosome().at(k);
-            parent2->getChromosome().at(k) = gene;
+        std::vector<std::uint64_t> &chromosome1 = parent1->getChromosome();
+        std::vector<std::uint64_t> &chromosome2 = parent2->getChromosome();
+        unsigned int locus = xover_point + 1;
+        bool changed = false;
+        for (auto k = static_cast<unsigned int>(locus / BitVectorIndividual::WORD_SIZE); k < chromosome1.size(); k++) {
+            std::uint64_t mask = ~std::uint64_t(0);
+            if (k == locus / BitVectorIndividual::WORD_SIZE)
+                mask <<= locus % BitVectorIndividual::WORD_SIZE;
+
+            std::uint64_t difference = (chromosome1.at(k) ^ chromosome2.at(k)) & mask;
+            chromosome1.at(k) ^= difference;
+            if (both)
+                chromosome2.at(k) ^= difference;
+            changed |= difference != 0;
         }
 
-        parent1->setEvaluated(false);
-        parent2->setEvaluated(false);
+        if (changed) {
+            parent1->setEvaluated(false);
+            if (both)
+                parent2->setEvaluated(false);
+        }
     }
-
-    return parents;
-}
\ No newline at end of file
+}
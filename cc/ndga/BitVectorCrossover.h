@@ -28,12 +28,28 @@ protected:
     unsigned long expectedSources() const override;
 
     /**
-     * Performs a one point crossover of two parents with a probability pc.
+     * Performs a one point crossover of two parents with a probability pc by swapping the masked words behind
+     * the crossover point.
      * @param parents Parent individuals to be crossed over.
      * @param thread  The variating thread.
      */
     std::vector<Individual *> & breed(std::vector<Individual *> &parents, Thread &thread) const override;
 
+    /**
+     * Modifies only the first parent if a single offspring is needed, thus the second parent may be lent.
+     */
+    unsigned long demand(unsigned long needed) const override;
+
+    /**
+     * Performs the same crossover as breed, but only keeps the first offspring if a single offspring is needed.
+     */
+    std::vector<Individual *> & breedExactly(std::vector<Individual *> &parents,
+                                             unsigned long needed,
+                                             Thread &thread) const override;
+
+private:
+    void cross(std::vector<Individual *> &parents, bool both, Thread &thread) const;
+
 };
 
 
@@ -1,9 +1,10 @@
 #include "BitVectorMutation.h"
-#include "../common/VectorIndividual.h"
-#include <iostream>
+#include "../common/BitVectorIndividual.h"
+#include <algorithm>
 
 BitVectorMutation::BitVectorMutation(const common::Configuration &configuration) : BreedingOperator(configuration) {
     this->pm = configuration.getMutationConfiguration().mutation_rate;
+    this->geometric = configuration.getMutationConfiguration().geometric;
 }
 
 BitVectorMutation * BitVectorMutation::clone() const {
@@ -12,21 +13,51 @@ BitVectorMutation * BitVectorMutation::clone() const {
 
 BitVectorMutation::BitVectorMutation(const BitVectorMutation &obj) : BreedingOperator(obj) {
     this->pm = obj.pm;
+    this->geometric = obj.geometric;
 }
 
 unsigned long BitVectorMutation::expectedSources() const { return 1; }
 
 std::vector<Individual *> & BitVectorMutation::breed(std::vector<Individual *> &parents, Thread &thread) const {
     for (auto *parent : parents) {
-        auto *p = dynamic_cast<VectorIndividual *>(parent);
-        auto genes = p->getChromosome().size();
-        for (unsigned int k = 0; k < genes; k++) {
-            if (thread.random.sample() < pm) {
-                p->getChromosome().at(k) = 1 - p->getChromosome().at(k);
+        auto *p = dynamic_cast<BitVectorIndividual *>(parent);
+        std::vector<std::uint64_t> &chromosome = p->getChromosome();
+        unsigned int genes = p->getGenes();
+        if (geometric) {
+            unsigned long long locus = thread.random.sampleIntFromGeometricDistribution(pm);
+            if (locus < genes)
                 p->setEvaluated(false);
+            for (; locus < genes; locus += 1ull + thread.random.sampleIntFromGeometricDistribution(pm)) {
+                chromosome.at(locus / BitVectorIndividual::WORD_SIZE) ^= std::uint64_t(1) << locus % BitVectorIndividual::WORD_SIZE;
+            }
+        } else {
+            for (unsigned int k = 0; k < chromosome.size(); k++) {
+                std::uint64_t flips = 0;
+                unsigned int loci = std::min(BitVectorIndividual::WORD_SIZE, genes - k * BitVectorIndividual::WORD_SIZE);
+                for (unsigned int l = 0; l < loci; l++) {
+                    if (thread.random.sample() < pm)
+                        flips |= std::uint64_t(1) << l;
+                }
+
+                if (flips != 0) {
+                    chromosome.at(k) ^= flips;
+                    p->setEvaluated(false);
+                }
             }
         }
     }
 
     return parents;
-}
\ No newline at end of file
+}
+
+unsigned long BitVectorMutation::demand(unsigned long needed) const {
+    return needed;
+}
+
+std::vector<Individual *> & BitVectorMutation::breedExactly(std::vector<Individual *> &parents,
+                                                            unsigned long needed,
+                                                            Thread &thread) const {
+    if (needed < parents.size())
+        parents.resize(needed);
+    return breed(parents, thread);
+}
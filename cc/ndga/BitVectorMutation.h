@@ -22,18 +22,30 @@ public:
 
 protected:
     float pm;
+    bool geometric;
 
     BitVectorMutation(const BitVectorMutation &obj);
 
     unsigned long expectedSources() const override;
 
     /**
-     * Performs a bit flip on each locus of the parents' chromosomes with a probability pm.
+     * Performs a bit flip on each locus of the parents' chromosomes with a probability pm. In the geometric mode, the
+     * gap to the next flipped locus is sampled instead, so that only the flipped loci are touched. Otherwise, the
+     * flips of each word are collected in a mask and applied at once.
      * @param parents Parent individuals to be mutated.
      * @param thread  The variating thread.
      */
     std::vector<Individual *> & breed(std::vector<Individual *> &parents, Thread &thread) const override;
 
+    /**
+     * Mutates each needed offspring in place, thus the operator modifies exactly as many parents as offsprings needed.
+     */
+    unsigned long demand(unsigned long needed) const override;
+
+    std::vector<Individual *> & breedExactly(std::vector<Individual *> &parents,
+                                             unsigned long needed,
+                                             Thread &thread) const override;
+
 };
 
 
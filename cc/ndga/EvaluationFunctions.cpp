@@ -1,68 +1,89 @@
+#include <bitset>
 #include "EvaluationFunctions.h"
-#include "../common/VectorIndividual.h"
+#include "../common/BitVectorIndividual.h"
 
-ndga::EvaluationFunctions::OneMaxEval::OneMaxEval() : EvaluationFunction() {}
+namespace {
 
-EvaluationFunction* ndga::EvaluationFunctions::OneMaxEval::clone() const {
-    return new OneMaxEval(*this);
+    int oneMax(int ones, int genes) {
+        return genes - ones;
+    }
+
+    int narrowedOneMax(int ones, int genes) {
+        int fitness = genes - ones;
+        if (fitness > 1)
+            fitness = 1;
+        return fitness;
+    }
+
+    int deceptiveOneMax(int ones, int genes) {
+        int fitness = 1 + ones;
+        int zeroes = genes - ones;
+        if (zeroes == 0)
+            fitness = 0;
+        return fitness;
+    }
 }
 
-void ndga::EvaluationFunctions::OneMaxEval::operator()(Individual &individual, Thread &thread) {
-    if (!individual.isEvaluated()) {
-        std::vector<float> &chromosome = dynamic_cast<VectorIndividual &>(individual).getChromosome();
+ndga::EvaluationFunctions::OnesEval::OnesEval(int (*fitness)(int, int)) : EvaluationFunction(), fitness(fitness) {}
 
-        int fitness = 0;
-        for (float k : chromosome)
-            fitness += 1 - k;
+void ndga::EvaluationFunctions::OnesEval::operator()(Individual &individual, Thread &thread) {
+    if (!individual.isEvaluated()) {
+        auto &bitvector = dynamic_cast<BitVectorIndividual &>(individual);
 
-        individual.getRelevance().setFitness(fitness);
+        individual.getRelevance().setFitness(fitness(bitvector.countOnes(), bitvector.getGenes()));
         individual.setEvaluated(true);
     }
 }
 
-ndga::EvaluationFunctions::NarrowedOneMaxEval::NarrowedOneMaxEval() : EvaluationFunction() {}
+void ndga::EvaluationFunctions::OnesEval::evaluateBatch(std::vector<Individual *> &individuals,
+                                                        const std::vector<unsigned int> &slots,
+                                                        Thread &thread,
+                                                        const Clock *clock) {
+    if (individuals.empty())
+        return;
+
+    // The individuals of a batch are clones of the same prototype, thus its type and size are only checked once.
+    auto &prototype = dynamic_cast<BitVectorIndividual &>(*individuals.front());
+    int genes = prototype.getGenes();
+
+    std::vector<int> ones(individuals.size(), 0);
+    for (unsigned int k = 0; k < individuals.size(); k++) {
+        const std::vector<std::uint64_t> &words = static_cast<BitVectorIndividual *>(individuals[k])->getChromosome();
+        int count = 0;
+        for (std::uint64_t word : words)
+            count += static_cast<int>(std::bitset<BitVectorIndividual::WORD_SIZE>(word).count());
+        ones[k] = count;
+    }
 
-EvaluationFunction* ndga::EvaluationFunctions::NarrowedOneMaxEval::clone() const {
-    return new NarrowedOneMaxEval(*this);
+    for (unsigned int k = 0; k < individuals.size(); k++) {
+        Individual &individual = *individuals[k];
+        if (!individual.isEvaluated()) {
+            individual.getRelevance().setFitness(fitness(ones[k], genes));
+            individual.setEvaluated(true);
+        }
+    }
 }
 
-void ndga::EvaluationFunctions::NarrowedOneMaxEval::operator()(Individual &individual, Thread &thread) {
-    if (!individual.isEvaluated()) {
-        std::vector<float> &chromosome = dynamic_cast<VectorIndividual &>(individual).getChromosome();
+bool ndga::EvaluationFunctions::OnesEval::isBatched() const {
+    return true;
+}
 
-        int fitness = 0;
-        for (float k : chromosome)
-            fitness += 1 - k;
-        if (fitness > 1)
-            fitness = 1;
+ndga::EvaluationFunctions::OneMaxEval::OneMaxEval() : OnesEval(oneMax) {}
 
-        individual.getRelevance().setFitness(fitness);
-        individual.setEvaluated(true);
-    }
+EvaluationFunction* ndga::EvaluationFunctions::OneMaxEval::clone() const {
+    return new OneMaxEval(*this);
 }
 
-ndga::EvaluationFunctions::DeceptiveOneMaxEval::DeceptiveOneMaxEval() : EvaluationFunction() {}
+ndga::EvaluationFunctions::NarrowedOneMaxEval::NarrowedOneMaxEval() : OnesEval(narrowedOneMax) {}
 
-EvaluationFunction* ndga::EvaluationFunctions::DeceptiveOneMaxEval::clone() const {
-    return new DeceptiveOneMaxEval(*this);
+EvaluationFunction* ndga::EvaluationFunctions::NarrowedOneMaxEval::clone() const {
+    return new NarrowedOneMaxEval(*this);
 }
 
-void ndga::EvaluationFunctions::DeceptiveOneMaxEval::operator()(Individual &individual, Thread &thread) {
-    if (!individual.isEvaluated()) {
-        std::vector<float> &chromosome = dynamic_cast<VectorIndividual &>(individual).getChromosome();
-
-        int fitness = 1;
-        int zeroes = 0;
-        for (float k : chromosome) {
-            fitness += k;
-            zeroes += 1 - k;
-        }
-        if (zeroes == 0)
-            fitness = 0;
+ndga::EvaluationFunctions::DeceptiveOneMaxEval::DeceptiveOneMaxEval() : OnesEval(deceptiveOneMax) {}
 
-        individual.getRelevance().setFitness(fitness);
-        individual.setEvaluated(true);
-    }
+EvaluationFunction* ndga::EvaluationFunctions::DeceptiveOneMaxEval::clone() const {
+    return new DeceptiveOneMaxEval(*this);
 }
 
 EvaluationFunction * ndga::EvaluationFunctions::evalOneMax() {
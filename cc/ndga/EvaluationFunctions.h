@@ -7,7 +7,9 @@
 namespace ndga {
 
     /**
-     * A collection of common evaluation functions for Neuro-Dynamic Genetic Algorithms (NDGAs).
+     * A collection of common evaluation functions for Neuro-Dynamic Genetic Algorithms (NDGAs). These functions
+     * evaluate bit vector individuals by counting their genes a whole word at a time and accept whole batches of
+     * individuals from the evaluator.
      *
      * @author  Felix Voelker
      * @version 0.1.1
@@ -15,19 +17,43 @@ namespace ndga {
      */
     class EvaluationFunctions {
 
+        /**
+         * The base class of all evaluation functions whose fitness only depends on the number of ones of a bit vector
+         * individual. A batch is evaluated in two passes, i.e. the packed chromosomes of all individuals are counted
+         * word by word before the fitnesses are assigned.
+         */
+        class OnesEval : public EvaluationFunction {
+
+        public:
+            void operator()(Individual &individual, Thread &thread) override;
+            void evaluateBatch(std::vector<Individual *> &individuals,
+                               const std::vector<unsigned int> &slots,
+                               Thread &thread,
+                               const Clock *clock) override;
+            bool isBatched() const override;
+
+        protected:
+            /**
+             * @param fitness Maps the number of ones and the number of genes of an individual onto its fitness.
+             */
+            explicit OnesEval(int (*fitness)(int, int));
+            OnesEval(const OnesEval &obj) = default;
+
+        private:
+            int (*fitness)(int, int);
+        };
+
         /**
          * The evaluation function of the one max problem, i.e. the problem of finding the bit vector with the highest
          * number of ones possible.
          */
-        class OneMaxEval : public EvaluationFunction {
+        class OneMaxEval : public OnesEval {
 
         public:
             explicit OneMaxEval();
 
             EvaluationFunction * clone() const override;
 
-            void operator()(Individual &individual, Thread &thread) override;
-
         protected:
             OneMaxEval(const OneMaxEval &obj) = default;
         };
@@ -36,15 +62,13 @@ namespace ndga {
          * The evaluation function of the one max problem, i.e. the problem of finding the bit vector with the highest
          * number of ones possible. However, the fitness is squeezed through an evaluation bottleneck.
          */
-        class NarrowedOneMaxEval : public EvaluationFunction {
+        class NarrowedOneMaxEval : public OnesEval {
 
         public:
             explicit NarrowedOneMaxEval();
 
             EvaluationFunction * clone() const override;
 
-            void operator()(Individual &individual, Thread &thread) override;
-
         protected:
             NarrowedOneMaxEval(const NarrowedOneMaxEval &obj) = default;
         };
@@ -53,15 +77,13 @@ namespace ndga {
          * The evaluation function of the one max problem, i.e. the problem of finding the bit vector with the highest
          * number of ones possible. However, the fitness leads to the wrong search gradient deliberately.
          */
-        class DeceptiveOneMaxEval : public EvaluationFunction {
+        class DeceptiveOneMaxEval : public OnesEval {
 
         public:
             explicit DeceptiveOneMaxEval();
 
             EvaluationFunction * clone() const override;
 
-            void operator()(Individual &individual, Thread &thread) override;
-
         protected:
             DeceptiveOneMaxEval(const DeceptiveOneMaxEval &obj) = default;
         };
@@ -1,6 +1,6 @@
 #include "RandomBitVectorBuilder.h"
 
-RandomBitVectorBuilder::RandomBitVectorBuilder(const common::Configuration &configuration, VectorIndividual &prototype)
+RandomBitVectorBuilder::RandomBitVectorBuilder(const common::Configuration &configuration, BitVectorIndividual &prototype)
         : Builder(configuration, prototype) {}
 
 Builder * RandomBitVectorBuilder::clone() const {
@@ -8,8 +8,8 @@ Builder * RandomBitVectorBuilder::clone() const {
 }
 
 void RandomBitVectorBuilder::initialize(Individual &individual, Thread &thread) const {
-    std::vector<float> &chromosome = dynamic_cast<VectorIndividual &>(individual).getChromosome();
-    for (auto &k : chromosome) {
-        k = thread.random.sampleIntFromUniformDistribution(2);
-    }
+    auto &bitvector = dynamic_cast<BitVectorIndividual &>(individual);
+    std::vector<std::uint64_t> &chromosome = bitvector.getChromosome();
+    thread.random.fill(chromosome);
+    chromosome.back() &= bitvector.getTailMask();
 }
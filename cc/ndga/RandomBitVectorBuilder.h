@@ -3,10 +3,10 @@
 
 
 #include "../../core/initialization/Builder.h"
-#include "../common/VectorIndividual.h"
+#include "../common/BitVectorIndividual.h"
 
 /**
- * A bit vector builder for Neuro-Dynamic Genetic Algorithms (NDGAs) that samples the genes of a vector individual's
+ * A bit vector builder for Neuro-Dynamic Genetic Algorithms (NDGAs) that samples the genes of a bit vector individual's
  * chromosome randomly.
  *
  * @author  Felix Voelker
@@ -16,7 +16,7 @@
 class RandomBitVectorBuilder : public Builder {
 
 public:
-    explicit RandomBitVectorBuilder(const common::Configuration &configuration, VectorIndividual &prototype);
+    explicit RandomBitVectorBuilder(const common::Configuration &configuration, BitVectorIndividual &prototype);
 
     Builder * clone() const override;
 
@@ -24,7 +24,7 @@ protected:
     RandomBitVectorBuilder(const RandomBitVectorBuilder &obj) = default;
 
     /**
-     * Samples each gene of the chromosome from a uniform discrete distribution U~(0,1).
+     * Samples each gene of the chromosome from a uniform discrete distribution U~(0,1) a whole word at a time.
      * @param individual The individual to be initialized.
      * @param thread     The initializing thread.
      */
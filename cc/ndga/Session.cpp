@@ -30,7 +30,7 @@ EvolutionarySystem* ndga::Session::build(RandomBitVectorBuilder &builder) {
     return system;
 }
 
-EvolutionarySystem* ndga::Session::build(TransitionTable &network) {
+EvolutionarySystem* ndga::Session::build(EvolutionaryNetwork &network) {
     RandomBitVectorBuilder *builder = constructDefaultBuilder();
     BreedingOperator *variation_tree = constructDefaultVariation();
     EvolutionarySystem *system = core::Session::build(*builder, network, *variation_tree);
@@ -48,7 +48,7 @@ EvolutionarySystem* ndga::Session::build(BreedingOperator &variation_tree) {
     return system;
 }
 
-EvolutionarySystem* ndga::Session::build(RandomBitVectorBuilder &builder, TransitionTable &network) {
+EvolutionarySystem* ndga::Session::build(RandomBitVectorBuilder &builder, EvolutionaryNetwork &network) {
     BreedingOperator *variation_tree = constructDefaultVariation();
     EvolutionarySystem *system = core::Session::build(builder, network, *variation_tree);
     delete variation_tree;
@@ -62,7 +62,7 @@ EvolutionarySystem* ndga::Session::build(RandomBitVectorBuilder &builder, Breedi
     return system;
 }
 
-EvolutionarySystem* ndga::Session::build(TransitionTable &network, BreedingOperator &variation_tree) {
+EvolutionarySystem* ndga::Session::build(EvolutionaryNetwork &network, BreedingOperator &variation_tree) {
     RandomBitVectorBuilder *builder = constructDefaultBuilder();
     EvolutionarySystem *system = core::Session::build(*builder, network, variation_tree);
     delete builder;
@@ -73,7 +73,7 @@ RandomBitVectorBuilder * ndga::Session::constructDefaultBuilder() {
     auto *config = dynamic_cast<common::Configuration *>(configuration);
     auto *featuremap = new FeatureVector(*config);
     auto *relevance = new Relevance(*configuration);
-    auto *individual = new VectorIndividual(*config, *featuremap, *relevance);
+    auto *individual = new BitVectorIndividual(*config, *featuremap, *relevance);
     auto *builder = new RandomBitVectorBuilder(*config, *individual);
     delete individual;
     delete relevance;
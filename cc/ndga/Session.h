@@ -35,10 +35,11 @@ namespace ndga {
         EvolutionarySystem * build(RandomBitVectorBuilder &builder);
 
         /**
-         * Sets up the evolutionary system for a NDGA with an arbitrary evolutionary network.
+         * Sets up the evolutionary system for a NDGA with an arbitrary evolutionary network, e.g. a transition table or
+         * a multilayer perceptron.
          * @param network The cost approximating evolutionary network.
          */
-        EvolutionarySystem * build(TransitionTable &network);
+        EvolutionarySystem * build(EvolutionaryNetwork &network);
 
         /**
          * Sets up the evolutionary system for a NDGA with an arbitrary variation tree.
@@ -51,7 +52,7 @@ namespace ndga {
          * @param builder The bit vector builder of the evolutionary system's vector individuals.
          * @param network The cost approximating evolutionary network.
          */
-        EvolutionarySystem * build(RandomBitVectorBuilder &builder, TransitionTable &network);
+        EvolutionarySystem * build(RandomBitVectorBuilder &builder, EvolutionaryNetwork &network);
 
         /**
          * Sets up the evolutionary system for a NDGA with an arbitrary builder and variation tree.
@@ -65,7 +66,7 @@ namespace ndga {
          * @param network The cost approximating evolutionary network.
          * @param variation_tree The offspring breeding variation tree.
          */
-        EvolutionarySystem * build(TransitionTable &network, BreedingOperator &variation_tree);
+        EvolutionarySystem * build(EvolutionaryNetwork &network, BreedingOperator &variation_tree);
 
     protected:
         /**
@@ -9,6 +9,8 @@ core::Configuration::EvolutionarySystemConfiguration::EvolutionarySystemConfigur
     this->generations = obj.generations;
     this->episodes = obj.episodes;
     this->epochs = obj.epochs;
+    this->concurrency = obj.concurrency;
+    this->seed = obj.seed;
 }
 
 core::Configuration::InitializerConfiguration::InitializerConfiguration(const InitializerConfiguration &obj) {
@@ -17,17 +19,35 @@ core::Configuration::InitializerConfiguration::InitializerConfiguration(const In
 
 core::Configuration::EvaluatorConfiguration::EvaluatorConfiguration(const EvaluatorConfiguration &obj) {
     this->threads = obj.threads;
+    this->grainsize = obj.grainsize;
+    this->stealing = obj.stealing;
+    this->cache = obj.cache;
+    this->shards = obj.shards;
 }
 
 core::Configuration::BreederConfiguration::BreederConfiguration(const BreederConfiguration &obj) {
     this->threads = obj.threads;
 }
 
+core::Configuration::ReplayerConfiguration::ReplayerConfiguration(const ReplayerConfiguration &obj) {
+    this->threads = obj.threads;
+    this->asynchronous = obj.asynchronous;
+    this->capacity = obj.capacity;
+    this->minibatch = obj.minibatch;
+    this->prioritized = obj.prioritized;
+    this->priority_exponent = obj.priority_exponent;
+}
+
 core::Configuration::EvolutionaryNetworkConfiguration::EvolutionaryNetworkConfiguration(const EvolutionaryNetworkConfiguration &obj) {
     this->learning_rate = obj.learning_rate;
     this->discount_factor = obj.discount_factor;
 }
 
+core::Configuration::StatisticsConfiguration::StatisticsConfiguration(const StatisticsConfiguration &obj) {
+    this->threads = obj.threads;
+    this->series = obj.series;
+}
+
 core::Configuration::Configuration(const ProblemConfiguration &problem) : problem(problem) {}
 
 core::Configuration::Configuration(const Configuration &obj) : problem(obj.problem) {
@@ -35,7 +55,9 @@ core::Configuration::Configuration(const Configuration &obj) : problem(obj.probl
     initializer = InitializerConfiguration(obj.initializer);
     evaluator = EvaluatorConfiguration(obj.evaluator);
     breeder = BreederConfiguration(obj.breeder);
+    replayer = ReplayerConfiguration(obj.replayer);
     evolutionary_network = EvolutionaryNetworkConfiguration(obj.evolutionary_network);
+    statistics = StatisticsConfiguration(obj.statistics);
 }
 
 const core::Configuration::ProblemConfiguration& core::Configuration::getProblemConfiguration() const {
@@ -74,6 +96,14 @@ const core::Configuration::BreederConfiguration & core::Configuration::getBreede
     return breeder;
 }
 
+core::Configuration::ReplayerConfiguration & core::Configuration::getReplayerConfiguration() {
+    return replayer;
+}
+
+const core::Configuration::ReplayerConfiguration & core::Configuration::getReplayerConfiguration() const {
+    return replayer;
+}
+
 core::Configuration::EvolutionaryNetworkConfiguration & core::Configuration::getEvolutionaryNetworkConfiguration() {
     return evolutionary_network;
 }
@@ -81,3 +111,11 @@ core::Configuration::EvolutionaryNetworkConfiguration & core::Configuration::get
 const core::Configuration::EvolutionaryNetworkConfiguration & core::Configuration::getEvolutionaryNetworkConfiguration() const {
     return evolutionary_network;
 }
+
+core::Configuration::StatisticsConfiguration & core::Configuration::getStatisticsConfiguration() {
+    return statistics;
+}
+
+const core::Configuration::StatisticsConfiguration & core::Configuration::getStatisticsConfiguration() const {
+    return statistics;
+}
@@ -34,6 +34,8 @@ namespace core {
          * @param epochs      Number of epochs to run.
          * @param episodes    Number of evolutions in each epoch.
          * @param generations Maximum number of generations to evolve.
+         * @param concurrency Number of episodes that are evolved concurrently on separate populations.
+         * @param seed        Seed of the random streams that makes a run reproducible, 0 for a random seed.
          */
         struct EvolutionarySystemConfiguration {
             EvolutionarySystemConfiguration() = default;
@@ -43,6 +45,8 @@ namespace core {
             unsigned int epochs = 10;
             unsigned int episodes = 100000;
             unsigned int generations = 200;
+            unsigned int concurrency = 1;
+            unsigned long long seed = 0;
         };
 
         /**
@@ -58,13 +62,21 @@ namespace core {
 
         /**
          * The configuration of the evaluator.
-         * @param threads Number of used threads during evaluation phase.
+         * @param threads   Number of used threads during evaluation phase.
+         * @param grainsize Number of individuals that are evaluated by a thread at once.
+         * @param stealing  Determines whether idle threads steal the grains of busy threads.
+         * @param cache     Maximum number of genotypes in the fitness cache, 0 disables the cache.
+         * @param shards    Number of independently locked shards of the fitness cache.
          */
         struct EvaluatorConfiguration {
             EvaluatorConfiguration() = default;
             EvaluatorConfiguration(const EvaluatorConfiguration &obj);
 
             unsigned int threads = 1;
+            unsigned int grainsize = 8;
+            bool stealing = true;
+            unsigned int cache = 0;
+            unsigned int shards = 16;
         };
 
         /**
@@ -78,6 +90,29 @@ namespace core {
             unsigned int threads = 1;
         };
 
+        /**
+         * The configuration of the replayer.
+         * @param threads      Number of used threads to update the evolutionary network.
+         * @param asynchronous Determines whether a dedicated thread trains the network while the evolution proceeds,
+         *                     which only applies to a single lane.
+         * @param capacity     Maximum number of transitions kept in the replay memory, which is disabled by 0.
+         * @param minibatch    Number of transitions that are replayed from the memory per generation.
+         * @param prioritized  Determines whether the memory samples transitions by their temporal difference errors
+         *                     instead of uniformly.
+         * @param priority_exponent The extent of prioritization, i.e. 0 corresponds to uniform sampling.
+         */
+        struct ReplayerConfiguration {
+            ReplayerConfiguration() = default;
+            ReplayerConfiguration(const ReplayerConfiguration &obj);
+
+            unsigned int threads = 1;
+            bool asynchronous = false;
+            unsigned int capacity = 0;
+            unsigned int minibatch = 32;
+            bool prioritized = false;
+            float priority_exponent = 0.6f;
+        };
+
         /**
          * The configuration of the evolutionary network.
          * @param discount_factor Factor of influence for delayed costs.
@@ -91,6 +126,19 @@ namespace core {
             float learning_rate = 0.1f;
         };
 
+        /**
+         * The configuration of the statistics.
+         * @param threads Number of used threads to reduce the population's relevances.
+         * @param series  Bit mask of the recorded series as defined by Statistics::Series, i.e. all series by default.
+         */
+        struct StatisticsConfiguration {
+            StatisticsConfiguration() = default;
+            StatisticsConfiguration(const StatisticsConfiguration &obj);
+
+            unsigned int threads = 1;
+            unsigned int series = ~0u;
+        };
+
         explicit Configuration(const ProblemConfiguration &problem);
         Configuration(const Configuration &obj);
         virtual ~Configuration() = default;
@@ -104,8 +152,12 @@ namespace core {
         const EvaluatorConfiguration & getEvaluatorConfiguration() const;
         BreederConfiguration & getBreederConfiguration();
         const BreederConfiguration & getBreederConfiguration() const;
+        ReplayerConfiguration & getReplayerConfiguration();
+        const ReplayerConfiguration & getReplayerConfiguration() const;
         EvolutionaryNetworkConfiguration & getEvolutionaryNetworkConfiguration();
         const EvolutionaryNetworkConfiguration & getEvolutionaryNetworkConfiguration() const;
+        StatisticsConfiguration & getStatisticsConfiguration();
+        const StatisticsConfiguration & getStatisticsConfiguration() const;
 
     protected:
         const ProblemConfiguration &problem;
@@ -113,7 +165,9 @@ namespace core {
         InitializerConfiguration initializer;
         EvaluatorConfiguration evaluator;
         BreederConfiguration breeder;
+        ReplayerConfiguration replayer;
         EvolutionaryNetworkConfiguration evolutionary_network;
+        StatisticsConfiguration statistics;
 
     };
 }
@@ -0,0 +1,59 @@
+#include "Episode.h"
+
+Episode::Episode(const core::Configuration &configuration,
+                 Builder &builder,
+                 const EvaluationFunction &eval,
+                 EvolutionaryNetwork &network,
+                 BreedingOperator &variation_tree,
+                 unsigned int &epoch,
+                 ThreadPool &pool,
+                 FitnessCache *cache,
+                 ReplayMemory *memory,
+                 unsigned long long seed)
+        : epoch(epoch),
+          population(configuration),
+          initializer(configuration, builder, epoch, pool, &clock),
+          evaluator(configuration, eval, network, pool, cache, &clock),
+          breeder(configuration, variation_tree, pool, &clock),
+          replayer(configuration, network, pool, memory, &clock),
+          statistics(configuration, pool)
+{
+    clock.seed = seed;
+    complete = configuration.getEvolutionarySystemConfiguration().complete;
+    generations = configuration.getEvolutionarySystemConfiguration().generations;
+}
+
+void Episode::evolve(unsigned int episode) {
+    clock.epoch = epoch;
+    clock.episode = episode;
+    clock.generation = 0;
+    initializer.initializePopulation(population);
+    for (unsigned int generation = 0; generation < generations; generation++) {
+        clock.generation = generation;
+        evaluator.evaluatePopulation(population);
+        statistics.record(population, epoch, generation);
+
+        if (!complete) {
+            if (population.bestIndividual()->getRelevance().isIdeal()) {
+                break;
+            }
+        }
+
+        breeder.breedPopulation(population);
+        replayer.replay(population);
+        breeder.recyclePopulation(population);
+        population.swap();
+    }
+    clock.generation = generations;
+    evaluator.evaluatePopulation(population);
+    statistics.record(population, epoch, generations);
+    population.exterminate();
+}
+
+const Evaluator & Episode::getEvaluator() const {
+    return evaluator;
+}
+
+Statistics & Episode::getStatistics() {
+    return statistics;
+}
@@ -0,0 +1,66 @@
+#ifndef RATATOSKR_EPISODE_H
+#define RATATOSKR_EPISODE_H
+
+
+#include "evaluation/Evaluator.h"
+#include "experience/Replayer.h"
+#include "initialization/Initializer.h"
+#include "representation/Population.h"
+#include "statistics/Statistics.h"
+#include "util/ThreadPool.h"
+#include "variation/Breeder.h"
+
+/**
+ * Represents a lane of the evolutionary system that evolves episodes on its own population. Each lane maintains its
+ * own phases and statistics, whereas the evolutionary network and the thread pool are shared among all lanes of the
+ * system. Accordingly, several lanes can evolve their episodes concurrently.
+ *
+ * @author  Felix Voelker
+ * @version 0.1.0
+ * @since   27.1.2018
+ */
+class Episode {
+
+public:
+    explicit Episode(const core::Configuration &configuration,
+                     Builder &builder,
+                     const EvaluationFunction &eval,
+                     EvolutionaryNetwork &network,
+                     BreedingOperator &variation_tree,
+                     unsigned int &epoch,
+                     ThreadPool &pool,
+                     FitnessCache *cache,
+                     ReplayMemory *memory,
+                     unsigned long long seed);
+
+    Episode(const Episode &obj) = delete;
+    Episode & operator=(const Episode &obj) = delete;
+
+    /**
+     * Evolves the lane's population over a number of generations or until an ideal individual has been found.
+     * @param episode Index of the episode within the current epoch, which determines its random streams.
+     */
+    void evolve(unsigned int episode);
+
+    Statistics & getStatistics();
+    const Evaluator & getEvaluator() const;
+
+private:
+    bool complete;
+    unsigned int generations;
+
+    unsigned int &epoch;
+    Clock clock;
+
+    /** Components */
+    Population  population;
+    Initializer initializer;
+    Evaluator   evaluator;
+    Breeder     breeder;
+    Replayer    replayer;
+    Statistics  statistics;
+
+};
+
+
+#endif //RATATOSKR_EPISODE_H
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <iostream>
 #include "EvolutionarySystem.h"
 #include "../cc/ndga/EvaluationFunctions.h"
@@ -7,61 +8,104 @@ EvolutionarySystem::EvolutionarySystem(const core::Configuration &configuration,
                                        const EvaluationFunction &eval,
                                        EvolutionaryNetwork &network,
                                        BreedingOperator &variation_tree)
-        : network(network.clone()),
-          population(Population(configuration)),
-          initializer(Initializer(configuration, builder, epoch)),
-          evaluator(Evaluator(configuration, eval, *this->network)),
-          breeder(Breeder(configuration, variation_tree)),
-          statistics(Statistics(configuration)),
-          replayer(Replayer(configuration, *this->network))
+        : pool(configuration),
+          cache(nullptr),
+          memory(nullptr),
+          lanes(std::max(configuration.getEvolutionarySystemConfiguration().concurrency, 1u)),
+          statistics(configuration)
 {
-    complete = configuration.getEvolutionarySystemConfiguration().complete;
     epochs = configuration.getEvolutionarySystemConfiguration().epochs;
     episodes = configuration.getEvolutionarySystemConfiguration().episodes;
-    generations = configuration.getEvolutionarySystemConfiguration().generations;
+
+    if (lanes.size() > 1) {
+        this->network = new SynchronizedNetwork(configuration, network.clone());
+    } else if (configuration.getReplayerConfiguration().asynchronous) {
+        this->network = new AsynchronousNetwork(configuration, network.clone());
+    } else {
+        this->network = network.clone();
+    }
+    this->network->attach(pool);
+    if (configuration.getEvaluatorConfiguration().cache > 0) {
+        cache = new FitnessCache(configuration.getEvaluatorConfiguration().cache,
+                                 configuration.getEvaluatorConfiguration().shards);
+    }
+    auto &replayer = configuration.getReplayerConfiguration();
+    if (replayer.capacity > 0 && replayer.prioritized)
+        memory = new PrioritizedReplayMemory(replayer.capacity, replayer.priority_exponent);
+    else if (replayer.capacity > 0)
+        memory = new ReplayMemory(replayer.capacity);
+    unsigned long long seed = configuration.getEvolutionarySystemConfiguration().seed;
+    if (seed == 0)
+        seed = static_cast<unsigned long long>(std::random_device()()) << 32 | std::random_device()();
+    for (auto &lane : lanes) {
+        lane = new Episode(configuration, builder, eval, *this->network, variation_tree, epoch, pool, cache, memory, seed);
+    }
 }
 
 EvolutionarySystem::~EvolutionarySystem() {
+    for (auto *lane : lanes)
+        delete lane;
+    std::vector<Episode *>().swap(lanes);
+
     delete network;
+    delete cache;
+    delete memory;
 }
 
 void EvolutionarySystem::run() {
     epoch = 0;
     for (unsigned int &k = epoch; k < epochs; k++) {
         std::cout << "Starting epoch " << epoch << "..." << std::endl;
-        for (unsigned int episode = 0; episode < episodes; episode++) {
-            if (episode % 250 == 0) {
-                std::cout << "Epoch " << epoch << ": " << episodes - episode << " episodes left." << std::endl;
+        if (lanes.size() == 1) {
+            for (unsigned int episode = 0; episode < episodes; episode++) {
+                if (episode % 250 == 0) {
+                    std::cout << "Epoch " << epoch << ": " << episodes - episode << " episodes left." << std::endl;
+                }
+                lanes.at(0)->evolve(episode);
+            }
+        } else {
+            std::vector<std::function<void()>> tasks(lanes.size());
+            for (unsigned int l = 0; l < lanes.size(); l++) {
+                Episode &lane = *lanes.at(l);
+                unsigned int stride = static_cast<unsigned int>(lanes.size());
+                tasks.at(l) = [this, &lane, l, stride] {
+                    for (unsigned int episode = l; episode < episodes; episode += stride)
+                        lane.evolve(episode);
+                };
             }
-            evolve();
+            pool.execute(tasks);
         }
+        auto *asynchronous = dynamic_cast<AsynchronousNetwork *>(network);
+        if (asynchronous != nullptr)
+            asynchronous->flush();
         std::cout << "Finished epoch " << epoch << "." << std::endl;
+        std::cout << "Skipped evaluations: " << getSkippedEvaluations() << "." << std::endl;
+        if (cache != nullptr) {
+            std::cout << "Fitness cache: " << cache->getHits() << " hits, " << cache->getMisses() << " misses ("
+                      << 100 * cache->getHitRate() << "%)." << std::endl;
+        }
     }
+
+    statistics.clear();
+    for (auto *lane : lanes)
+        statistics.merge(lane->getStatistics());
 }
 
 Statistics & EvolutionarySystem::getStatistics() {
     return statistics;
 }
 
-void EvolutionarySystem::evolve() {
-    initializer.initializePopulation(population);
-    for (unsigned int generation = 0; generation < generations; generation++) {
-        evaluator.evaluatePopulation(population);
-        statistics.record(population, epoch, generation);
+FitnessCache * EvolutionarySystem::getFitnessCache() {
+    return cache;
+}
 
-        if (!complete) {
-            if (population.bestIndividual()->getRelevance().isIdeal()) {
-                break;
-            }
-        }
+ReplayMemory * EvolutionarySystem::getReplayMemory() {
+    return memory;
+}
 
-        std::vector<Individual *> *offsprings = breeder.breedPopulation(population);
-        replayer.replay(population, *offsprings);
-        population.exterminate();
-        population.setIndividuals(*offsprings);
-        delete offsprings;
-    }
-    evaluator.evaluatePopulation(population);
-    statistics.record(population, epoch, generations);
-    population.exterminate();
-}
\ No newline at end of file
+unsigned long long EvolutionarySystem::getSkippedEvaluations() const {
+    unsigned long long skipped = 0;
+    for (auto *lane : lanes)
+        skipped += lane->getEvaluator().getSkippedEvaluations();
+    return skipped;
+}
@@ -2,12 +2,10 @@
 #define RATATOSKR_EVOLUTIONARYSYSTEM_H
 
 
-#include "evaluation/Evaluator.h"
-#include "experience/Replayer.h"
-#include "initialization/Initializer.h"
-#include "representation/Population.h"
-#include "statistics/Statistics.h"
-#include "variation/Breeder.h"
+#include "Episode.h"
+#include "experience/AsynchronousNetwork.h"
+#include "experience/PrioritizedReplayMemory.h"
+#include "experience/SynchronizedNetwork.h"
 
 /**
  * The core system that runs a Neuro-Dynamic Evolutionary Algorithm (NDEA), i.e. it evolves its evolutionary system
@@ -17,6 +15,11 @@
  * episodes that are organized into epochs. The core system does not only execute this workflow, it is also
  * self-contained in regard of the problem to be solved and the session to run.
  *
+ * The episodes of an epoch can be evolved concurrently by several lanes with separate populations. In this case, the
+ * lanes share a synchronized evolutionary network and their statistics are merged in lane order after each run. If
+ * configured, all lanes also share a fitness cache and a uniform or prioritized replay memory. A single lane may
+ * instead train its network asynchronously, which is brought up to date after each epoch.
+ *
  * @author  Felix Voelker
  * @version 0.1.0
  * @since   25.1.2018
@@ -33,34 +36,42 @@ public:
     ~EvolutionarySystem();
 
     /**
-     * Runs consecutive episodes of the evolutionary system until the total number of epochs has been processed.
+     * Runs consecutive episodes of the evolutionary system until the total number of epochs has been processed. If
+     * several lanes are configured, the i-th lane evolves the episodes i, i + lanes, i + 2 * lanes, ... of each epoch.
      */
     void run();
 
     Statistics & getStatistics();
 
+    /**
+     * Returns the shared fitness cache or a null pointer if the cache is disabled.
+     */
+    FitnessCache * getFitnessCache();
+
+    /**
+     * Returns the shared replay memory or a null pointer if the memory is disabled.
+     */
+    ReplayMemory * getReplayMemory();
+
+    /**
+     * Returns the number of evaluations that all lanes have skipped since the individuals were already evaluated.
+     */
+    unsigned long long getSkippedEvaluations() const;
+
 private:
-    bool complete;
     unsigned int epochs;
     unsigned int episodes;
-    unsigned int generations;
 
     unsigned int epoch;
 
     EvolutionaryNetwork * network;
+    ThreadPool pool;
+    FitnessCache *cache;
+    ReplayMemory *memory;
 
     /** Components */
-    Population  population;
-    Initializer initializer;
-    Evaluator   evaluator;
-    Breeder     breeder;
-    Replayer    replayer;
-    Statistics  statistics;
-
-    /**
-     * Evolves the evolutionary system over a number of generations or until an ideal individual has been found.
-     */
-    void evolve();
+    std::vector<Episode *> lanes;
+    Statistics statistics;
 
 };
 
@@ -1,3 +1,18 @@
 #include "EvaluationFunction.h"
 
 EvaluationFunction::EvaluationFunction() : Clonable() {}
+
+void EvaluationFunction::evaluateBatch(std::vector<Individual *> &individuals,
+                                       const std::vector<unsigned int> &slots,
+                                       Thread &thread,
+                                       const Clock *clock) {
+    for (unsigned int k = 0; k < individuals.size(); k++) {
+        if (clock != nullptr)
+            thread.random.seed(*clock, slots.at(k), Thread::Random::EVALUATION);
+        operator()(*individuals.at(k), thread);
+    }
+}
+
+bool EvaluationFunction::isBatched() const {
+    return false;
+}
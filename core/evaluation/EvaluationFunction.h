@@ -28,6 +28,27 @@ public:
      */
     virtual void operator()(Individual &individual, Thread &thread) = 0;
 
+    /**
+     * Assigns a fitness value to each individual of a batch at once, e.g. to process several genomes with vectorized
+     * instructions or to amortize the setup of an expensive evaluation. By default, the individuals are evaluated one
+     * after another and, if a clock is given, the thread's random module is reseeded with each individual's slot
+     * beforehand. Overrides that sample from the random module have to reseed it per slot likewise, otherwise their
+     * random numbers depend on how the population is cut into grains.
+     * @param individuals The individuals to be evaluated.
+     * @param slots       The population slots of the individuals.
+     * @param thread      The evaluating thread.
+     * @param clock       Position of the evaluating lane or null if the random streams are not reproducible.
+     */
+    virtual void evaluateBatch(std::vector<Individual *> &individuals,
+                               const std::vector<unsigned int> &slots,
+                               Thread &thread,
+                               const Clock *clock);
+
+    /**
+     * Determines whether the evaluator should pass whole batches to this function instead of single individuals.
+     */
+    virtual bool isBatched() const;
+
 protected:
     EvaluationFunction(const EvaluationFunction &obj) = default;
 
@@ -3,12 +3,29 @@
 
 Evaluator::Evaluator(const core::Configuration &configuration,
                      const EvaluationFunction &eval,
-                     EvolutionaryNetwork &network)
+                     EvolutionaryNetwork &network,
+                     ThreadPool &pool,
+                     FitnessCache *cache,
+                     const Clock *clock)
         : Singleton(configuration),
           evalthreads(std::vector<Thread *>(configuration.getEvaluatorConfiguration().threads)),
+          batches(std::vector<Batch>(configuration.getEvaluatorConfiguration().threads)),
+          scheduler(new WorkStealingScheduler(configuration.getEvaluatorConfiguration().threads,
+                                              configuration.getEvaluatorConfiguration().stealing)),
+          pool(pool),
+          cache(cache),
+          clock(clock),
+          skipped(0),
           eval(eval.clone()),
           network(network)
 {
+    grainsize = configuration.getEvaluatorConfiguration().grainsize;
+    for (auto &batch : batches) {
+        batch.individuals.reserve(grainsize);
+        batch.slots.reserve(grainsize);
+        batch.keys.reserve(grainsize);
+        batch.hashed.reserve(grainsize);
+    }
     unsigned int onset  = 0;
     unsigned int offset = configuration.getProblemConfiguration().popsize / configuration.getEvaluatorConfiguration().threads;
     for (unsigned int k = 0; k < evalthreads.size() - 1; k++) {
@@ -20,6 +37,7 @@ Evaluator::Evaluator(const core::Configuration &configuration,
 
 Evaluator::~Evaluator() {
     delete eval;
+    delete scheduler;
 
     for (auto *thread : evalthreads)
         delete thread;
@@ -28,22 +46,64 @@ Evaluator::~Evaluator() {
 
 void Evaluator::evaluatePopulation(Population &pop) const {
     auto &individuals = pop.getIndividuals();
-
-    std::vector<float> costs = network.output(individuals);
-
-    std::vector<std::thread> threads(evalthreads.size());
+    scheduler->distribute(static_cast<unsigned int>(individuals.size()), grainsize);
+    std::vector<std::function<void()>> tasks(evalthreads.size());
     for (unsigned int k = 0; k < evalthreads.size(); k++) {
-        threads.at(k) = std::thread(&Evaluator::evaluateChunk, this, std::ref(individuals), costs, std::ref(*evalthreads.at(k)));
+        tasks.at(k) = [this, &individuals, k] { evaluateGrains(individuals, k); };
     }
+    pool.execute(tasks);
+}
 
-    for (auto &thread : threads) {
-        thread.join();
+void Evaluator::evaluateGrains(std::vector<Individual *> &individuals, unsigned int worker) const {
+    Thread &thread = *evalthreads.at(worker);
+    Batch &batch = batches.at(worker);
+    unsigned int onset;
+    unsigned int offset;
+    unsigned long long unchanged = 0;
+    while (scheduler->fetch(worker, onset, offset)) {
+        batch.individuals.clear();
+        batch.slots.clear();
+        batch.keys.clear();
+        batch.hashed.clear();
+        for (unsigned int k = onset; k < onset + offset; k++) {
+            Individual &individual = *individuals.at(k);
+            if (individual.isEvaluated()) {
+                unchanged++;
+                continue;
+            }
+
+            unsigned long long key = 0;
+            float fitness;
+            bool hashed = cache != nullptr && individual.hash(key);
+            if (hashed && cache->lookup(key, fitness)) {
+                individual.getRelevance().setFitness(fitness);
+                individual.setEvaluated(true);
+            } else {
+                batch.individuals.push_back(&individual);
+                batch.slots.push_back(k);
+                batch.keys.push_back(key);
+                batch.hashed.push_back(hashed);
+            }
+        }
+
+        if (eval->isBatched() && !batch.individuals.empty()) {
+            eval->evaluateBatch(batch.individuals, batch.slots, thread, clock);
+        } else {
+            for (unsigned int l = 0; l < batch.individuals.size(); l++) {
+                if (clock != nullptr)
+                    thread.random.seed(*clock, batch.slots.at(l), Thread::Random::EVALUATION);
+                eval->operator()(*batch.individuals.at(l), thread);
+            }
+        }
+        for (unsigned int l = 0; l < batch.individuals.size(); l++) {
+            if (batch.hashed.at(l))
+                cache->insert(batch.keys.at(l), batch.individuals.at(l)->getRelevance().getFitness());
+        }
+        network.estimate(individuals, onset, offset);
     }
+    skipped.fetch_add(unchanged, std::memory_order_relaxed);
 }
 
-void Evaluator::evaluateChunk(std::vector<Individual *> &individuals, std::vector<float> costs, Thread &thread) const {
-    for (unsigned int k = 0; k < thread.getChunkOffset(); k++) {
-        eval->operator()(*individuals.at(k + thread.getChunkOnset()), thread);
-        individuals.at(k + thread.getChunkOnset())->getRelevance().setCost(costs.at(k + thread.getChunkOnset()));
-    }
+unsigned long long Evaluator::getSkippedEvaluations() const {
+    return skipped.load();
 }
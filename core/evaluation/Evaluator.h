@@ -2,16 +2,29 @@
 #define RATATOSKR_EVALUATOR_H
 
 
+#include <atomic>
 #include <functional>
 #include "../experience/EvolutionaryNetwork.h"
 #include "../representation/Population.h"
 #include "../util/Thread.h"
+#include "../util/ThreadPool.h"
+#include "../util/WorkStealingScheduler.h"
 #include "EvaluationFunction.h"
+#include "FitnessCache.h"
 
 /**
  * The core module that drives the evaluation phase of an Neuro-Dynamic Evolutionary Algorithm (NDEA). This evaluation
- * is performed on the entire population that is split into several uniformly divided chunks. These chunks are
- * concurrently processed by the evaluation threads whose number equals the amount of chunks.
+ * is performed on the entire population that is split into small grains of individuals. Each evaluation thread starts
+ * with an uniformly divided range of these grains and steals grains from the other threads once its own range is
+ * exhausted. Thus, individuals with an expensive evaluation do not stall the entire generation. Regardless of which
+ * grains it processes, each evaluation thread evaluates with its own random module. If a clock is given, each slot is
+ * evaluated with its own random stream instead.
+ *
+ * Individuals whose fitness is still up to date, e.g. offsprings that have not been modified by any operator, are not
+ * evaluated again. Optionally, a fitness cache short-circuits the evaluation of genotypes that have already been
+ * evaluated before. Evaluation functions that process batches receive the remaining individuals of a grain at once,
+ * along with their slots and the clock to reseed the random module per slot.
+ * Likewise, the costs are estimated by the evolutionary network grain by grain within the evaluation threads.
  *
  * @author  Felix Voelker
  * @version 0.1.0
@@ -22,7 +35,10 @@ class Evaluator : public Singleton {
 public:
     explicit Evaluator(const core::Configuration &configuration,
                        const EvaluationFunction &eval,
-                       EvolutionaryNetwork &network);
+                       EvolutionaryNetwork &network,
+                       ThreadPool &pool,
+                       FitnessCache *cache = nullptr,
+                       const Clock *clock = nullptr);
     ~Evaluator();
 
     /**
@@ -31,23 +47,44 @@ public:
      */
     void evaluatePopulation(Population &pop) const;
 
+    /**
+     * Returns the number of evaluations that have been skipped since the individuals were already evaluated.
+     */
+    unsigned long long getSkippedEvaluations() const;
+
 protected:
+    /**
+     * The individuals of a grain that actually need to be evaluated, along with their slots and cache keys.
+     */
+    struct Batch {
+        std::vector<Individual *> individuals;
+        std::vector<unsigned int> slots;
+        std::vector<unsigned long long> keys;
+        std::vector<bool> hashed;
+    };
+
+    unsigned int grainsize;
     std::vector<Thread *> evalthreads;
+    mutable std::vector<Batch> batches;
+    WorkStealingScheduler *scheduler;
+    ThreadPool &pool;
+    FitnessCache *cache;
+    const Clock *clock;
+    mutable std::atomic<unsigned long long> skipped;
 
     /** Components */
     EvaluationFunction  *eval;
     EvolutionaryNetwork &network;
 
     /**
-     * Evaluates a given chunk of the population only. This function is called by each of the evaluation threads
-     * and performs the problem specific evaluation on the individuals in the chunk.
+     * Evaluates grains of the population until no grains are left. This function is submitted to the thread pool for
+     * each evaluation thread and performs the problem specific evaluation on the individuals in each fetched grain
+     * unless their fitness is already cached. If the evaluation function is batched, the remaining individuals of
+     * each grain are passed to it at once. Afterwards, the network estimates the cost of the entire grain.
      * @param individuals The individuals within the population.
-     * @param costs       The approximated cost of each individual.
-     * @param thread      The evaluating thread.
+     * @param worker      Index of the evaluating thread.
      */
-    void evaluateChunk(std::vector<Individual *> &individuals,
-                       std::vector<float> costs,
-                       Thread &thread) const;
+    void evaluateGrains(std::vector<Individual *> &individuals, unsigned int worker) const;
 
 };
 
@@ -0,0 +1,57 @@
+#include "FitnessCache.h"
+
+FitnessCache::FitnessCache(unsigned int capacity, unsigned int shards)
+        : shards(std::vector<Shard>(shards > 0 ? shards : 1)),
+          hits(0),
+          misses(0)
+{
+    this->capacity = (capacity + this->shards.size() - 1) / this->shards.size();
+    if (this->capacity == 0)
+        this->capacity = 1;
+}
+
+bool FitnessCache::lookup(unsigned long long key, float &fitness) {
+    Shard &shard = this->shard(key);
+    bool found;
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto it = shard.fitnesses.find(key);
+        found = it != shard.fitnesses.end();
+        if (found)
+            fitness = it->second;
+    }
+    (found ? hits : misses).fetch_add(1, std::memory_order_relaxed);
+    return found;
+}
+
+void FitnessCache::insert(unsigned long long key, float fitness) {
+    Shard &shard = this->shard(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    if (shard.fitnesses.emplace(key, fitness).second) {
+        shard.insertions.push_back(key);
+        if (shard.insertions.size() > capacity) {
+            shard.fitnesses.erase(shard.insertions.front());
+            shard.insertions.pop_front();
+        }
+    }
+}
+
+unsigned long long FitnessCache::getHits() const {
+    return hits.load();
+}
+
+unsigned long long FitnessCache::getMisses() const {
+    return misses.load();
+}
+
+float FitnessCache::getHitRate() const {
+    unsigned long long lookups = getHits() + getMisses();
+    return lookups > 0 ? static_cast<float>(getHits()) / lookups : 0;
+}
+
+FitnessCache::Shard & FitnessCache::shard(unsigned long long key) {
+    key ^= key >> 33;
+    key *= 0xff51afd7ed558ccdull;
+    key ^= key >> 33;
+    return shards[key % shards.size()];
+}
@@ -0,0 +1,75 @@
+#ifndef RATATOSKR_FITNESSCACHE_H
+#define RATATOSKR_FITNESSCACHE_H
+
+
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Represents a concurrent memoization of the fitness of already evaluated genotypes. The genotypes are identified by
+ * the hash that their individuals supply and are distributed among several shards, each guarded by its own mutex, so
+ * that evaluation threads rarely contend for the same lock. Each shard holds a bounded number of genotypes and evicts
+ * the genotype that has been inserted first once it is full.
+ *
+ * The cache assumes that the evaluation function is deterministic, i.e. equal genotypes always yield equal fitness.
+ *
+ * @author  Felix Voelker
+ * @version 0.1.0
+ * @since   27.1.2018
+ */
+class FitnessCache {
+
+public:
+    /**
+     * Creates an empty cache.
+     * @param capacity Maximum number of cached genotypes.
+     * @param shards   Number of independently locked shards.
+     */
+    explicit FitnessCache(unsigned int capacity, unsigned int shards);
+
+    FitnessCache(const FitnessCache &obj) = delete;
+    FitnessCache & operator=(const FitnessCache &obj) = delete;
+
+    /**
+     * Looks up the fitness of a genotype and counts the access as hit or miss.
+     * @param key     Hash of the genotype.
+     * @param fitness The cached fitness if the genotype is known.
+     * @return True if the genotype is known, false otherwise.
+     */
+    bool lookup(unsigned long long key, float &fitness);
+
+    /**
+     * Caches the fitness of a genotype, evicting the oldest genotype of its shard if necessary.
+     */
+    void insert(unsigned long long key, float fitness);
+
+    unsigned long long getHits() const;
+    unsigned long long getMisses() const;
+
+    /**
+     * Returns the fraction of lookups that have been answered by the cache.
+     */
+    float getHitRate() const;
+
+private:
+    struct Shard {
+        std::mutex mutex;
+        std::unordered_map<unsigned long long, float> fitnesses;
+        std::deque<unsigned long long> insertions;
+    };
+
+    unsigned int capacity;
+    std::vector<Shard> shards;
+
+    std::atomic<unsigned long long> hits;
+    std::atomic<unsigned long long> misses;
+
+    Shard & shard(unsigned long long key);
+
+};
+
+
+#endif //RATATOSKR_FITNESSCACHE_H
@@ -0,0 +1,122 @@
+#include "AsynchronousNetwork.h"
+
+AsynchronousNetwork::AsynchronousNetwork(const core::Configuration &configuration, EvolutionaryNetwork *network)
+        : EvolutionaryNetwork(configuration),
+          front(network),
+          back(network->clone()),
+          replay(nullptr),
+          pending(nullptr),
+          missed(nullptr),
+          busy(false),
+          terminated(false)
+{
+    trainer = std::thread(&AsynchronousNetwork::train, this);
+}
+
+AsynchronousNetwork::~AsynchronousNetwork() {
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        condition.wait(lock, [this] { return !busy; });
+        terminated = true;
+    }
+    condition.notify_all();
+    trainer.join();
+
+    for (auto &transitions : records) {
+        for (auto *individual : transitions.parents)
+            delete individual;
+        for (auto *individual : transitions.offsprings)
+            delete individual;
+    }
+    delete front.load();
+    delete back;
+}
+
+std::vector<float> AsynchronousNetwork::output(std::vector<Individual *> &individuals) const {
+    return front.load(std::memory_order_acquire)->output(individuals);
+}
+
+void AsynchronousNetwork::estimate(std::vector<Individual *> &individuals, unsigned int onset, unsigned int offset) const {
+    front.load(std::memory_order_acquire)->estimate(individuals, onset, offset);
+}
+
+void AsynchronousNetwork::update(std::vector<Individual *> &parents, std::vector<Individual *> &offsprings) {
+    wait();
+    if (missed != nullptr)
+        back = front.exchange(back, std::memory_order_acq_rel);
+
+    // The other record has already been learned by both instances, thus its copies can be reused.
+    Transitions *current = missed == &records[0] ? &records[1] : &records[0];
+    retain(parents, current->parents);
+    retain(offsprings, current->offsprings);
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        replay = missed;
+        pending = current;
+        busy = true;
+    }
+    condition.notify_all();
+    missed = current;
+}
+
+void AsynchronousNetwork::flush() {
+    wait();
+    if (missed != nullptr) {
+        back = front.exchange(back, std::memory_order_acq_rel);
+        back->update(missed->parents, missed->offsprings);
+        missed = nullptr;
+    }
+}
+
+AsynchronousNetwork * AsynchronousNetwork::clone() const {
+    return new AsynchronousNetwork(*this);
+}
+
+AsynchronousNetwork::AsynchronousNetwork(const AsynchronousNetwork &obj)
+        : EvolutionaryNetwork(obj),
+          replay(nullptr),
+          pending(nullptr),
+          missed(nullptr),
+          busy(false),
+          terminated(false)
+{
+    obj.wait();
+    front = obj.back->clone();
+    back = obj.back->clone();
+    trainer = std::thread(&AsynchronousNetwork::train, this);
+}
+
+std::vector<unsigned long long> AsynchronousNetwork::preprocess(std::vector<Individual *> &individuals) const {
+    return front.load(std::memory_order_acquire)->preprocess(individuals);
+}
+
+void AsynchronousNetwork::train() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        condition.wait(lock, [this] { return busy || terminated; });
+        if (!busy)
+            return;
+
+        lock.unlock();
+        if (replay != nullptr)
+            back->update(replay->parents, replay->offsprings);
+        back->update(pending->parents, pending->offsprings);
+        lock.lock();
+
+        busy = false;
+        condition.notify_all();
+    }
+}
+
+void AsynchronousNetwork::wait() const {
+    std::unique_lock<std::mutex> lock(mutex);
+    condition.wait(lock, [this] { return !busy; });
+}
+
+void AsynchronousNetwork::retain(std::vector<Individual *> &individuals, std::vector<Individual *> &copies) {
+    copies.resize(individuals.size(), nullptr);
+    for (unsigned int k = 0; k < individuals.size(); k++) {
+        storage.release(copies.at(k));
+        copies.at(k) = storage.acquire(*individuals.at(k));
+    }
+}
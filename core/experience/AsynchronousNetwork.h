@@ -0,0 +1,99 @@
+#ifndef RATATOSKR_ASYNCHRONOUSNETWORK_H
+#define RATATOSKR_ASYNCHRONOUSNETWORK_H
+
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include "EvolutionaryNetwork.h"
+#include "../representation/IndividualPool.h"
+
+/**
+ * A decorator that takes the training of an evolutionary network off the critical path of the evolutionary loop. The
+ * decorator holds two instances of the network, i.e. a front instance that estimates the costs and a back instance that
+ * is trained by a dedicated trainer thread. Each update merely records the transitions of a generation and hands them
+ * over to the trainer. At the next update, the decorator waits for the trainer and publishes the back instance as the
+ * new front instance. The former front instance becomes the back instance and learns the transitions it has missed
+ * before it learns the new ones, thus both instances pass through the same updates in the same order. Accordingly,
+ * the estimated costs lag one generation behind the transitions.
+ *
+ * The decorator assumes that a single thread updates the network and that no thread estimates costs while it does.
+ * The decorated instances are never attached to a thread pool, so that the trainer does not compete for its workers.
+ *
+ * @author  Felix Voelker
+ * @version 0.1.0
+ * @since   27.1.2018
+ */
+class AsynchronousNetwork : public EvolutionaryNetwork {
+
+public:
+    /**
+     * Decorates a network, i.e. the decorator takes over its ownership.
+     * @param configuration The configuration of the evolutionary system.
+     * @param network       The network to be trained asynchronously.
+     */
+    explicit AsynchronousNetwork(const core::Configuration &configuration, EvolutionaryNetwork *network);
+    ~AsynchronousNetwork();
+
+    std::vector<float> output(std::vector<Individual *> &individuals) const override;
+    void estimate(std::vector<Individual *> &individuals, unsigned int onset, unsigned int offset) const override;
+
+    /**
+     * Records the transitions from the parents to the offsprings and hands them over to the trainer thread.
+     */
+    void update(std::vector<Individual *> &parents, std::vector<Individual *> &offsprings) override;
+
+    /**
+     * Waits for the trainer thread and brings both instances up to date with all recorded transitions.
+     */
+    void flush();
+
+    AsynchronousNetwork * clone() const override;
+
+protected:
+    AsynchronousNetwork(const AsynchronousNetwork &obj);
+
+    std::vector<unsigned long long> preprocess(std::vector<Individual *> &individuals) const override;
+
+private:
+    /**
+     * Copies of the parents and offsprings of a generation, since the population recycles its individuals.
+     */
+    struct Transitions {
+        std::vector<Individual *> parents;
+        std::vector<Individual *> offsprings;
+    };
+
+    std::atomic<EvolutionaryNetwork *> front;
+    EvolutionaryNetwork *back;
+
+    /** The transitions that the back instance has to learn next and those that the front instance has missed. */
+    Transitions records[2];
+    Transitions *replay;
+    Transitions *pending;
+    Transitions *missed;
+    IndividualPool storage;
+
+    std::thread trainer;
+    mutable std::mutex mutex;
+    mutable std::condition_variable condition;
+    bool busy;
+    bool terminated;
+
+    void train();
+
+    /**
+     * Blocks until the trainer thread has finished its current job.
+     */
+    void wait() const;
+
+    /**
+     * Replaces the copies of a record by copies of the given individuals.
+     */
+    void retain(std::vector<Individual *> &individuals, std::vector<Individual *> &copies);
+
+};
+
+
+#endif //RATATOSKR_ASYNCHRONOUSNETWORK_H
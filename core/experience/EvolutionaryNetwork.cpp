@@ -1,11 +1,44 @@
 #include "EvolutionaryNetwork.h"
 
-EvolutionaryNetwork::EvolutionaryNetwork(const core::Configuration &configuration) : Prototype(configuration) {
+EvolutionaryNetwork::EvolutionaryNetwork(const core::Configuration &configuration) : Prototype(configuration), pool(nullptr) {
     discount_factor = configuration.getEvolutionaryNetworkConfiguration().discount_factor;
     learning_rate = configuration.getEvolutionaryNetworkConfiguration().learning_rate;
 }
 
-EvolutionaryNetwork::EvolutionaryNetwork(const EvolutionaryNetwork &obj) : Prototype(obj) {
+void EvolutionaryNetwork::estimate(std::vector<Individual *> &individuals, unsigned int onset, unsigned int offset) const {
+    std::vector<Individual *> range(individuals.begin() + onset, individuals.begin() + onset + offset);
+    std::vector<float> costs = output(range);
+    for (unsigned int k = 0; k < offset; k++)
+        range.at(k)->getRelevance().setCost(costs.at(k));
+}
+
+bool EvolutionaryNetwork::isPartitioned() const {
+    return false;
+}
+
+void EvolutionaryNetwork::updateChunk(std::vector<Individual *> &parents,
+                                      std::vector<Individual *> &offsprings,
+                                      unsigned int onset,
+                                      unsigned int offset) {
+    if (onset == 0 && offset == parents.size())
+        update(parents, offsprings);
+}
+
+bool EvolutionaryNetwork::record(std::vector<Individual *> &parents,
+                                 std::vector<Individual *> &offsprings,
+                                 std::vector<Transition> &transitions) const {
+    return false;
+}
+
+void EvolutionaryNetwork::learn(const std::vector<Transition> &transitions, std::vector<float> &errors) {
+    errors.clear();
+}
+
+void EvolutionaryNetwork::attach(ThreadPool &pool) {
+    this->pool = &pool;
+}
+
+EvolutionaryNetwork::EvolutionaryNetwork(const EvolutionaryNetwork &obj) : Prototype(obj), pool(nullptr) {
     this->discount_factor = obj.discount_factor;
     this->learning_rate = obj.learning_rate;
 }
\ No newline at end of file
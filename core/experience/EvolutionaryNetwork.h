@@ -3,6 +3,8 @@
 
 
 #include "../representation/Population.h"
+#include "../util/ThreadPool.h"
+#include "Transition.h"
 
 /**
  * TODO: Comments
@@ -12,6 +14,9 @@
  */
 class EvolutionaryNetwork : public Prototype {
 
+    friend class SynchronizedNetwork;
+    friend class AsynchronousNetwork;
+
 public:
     explicit EvolutionaryNetwork(const core::Configuration &configuration);
     virtual ~EvolutionaryNetwork() = default;
@@ -23,6 +28,16 @@ public:
      */
     virtual std::vector<float> output(std::vector<Individual *> &individuals) const = 0;
 
+    /**
+     * Estimates the cost of the individuals within a range of slots and assigns it to their relevance. Since distinct
+     * ranges are estimated concurrently, the network must only be read. By default, the output is computed on a copy
+     * of the range as if it was a population of its own, hence networks that depend on the slots have to override it.
+     * @param individuals The individuals within the population.
+     * @param onset       The first slot of the range.
+     * @param offset      The number of slots within the range.
+     */
+    virtual void estimate(std::vector<Individual *> &individuals, unsigned int onset, unsigned int offset) const;
+
     /**
      *
      * @param parents
@@ -30,11 +45,58 @@ public:
      */
     virtual void update(std::vector<Individual *> &parents, std::vector<Individual *> &offsprings) = 0;
 
+    /**
+     * Determines whether the state of the network is partitioned by slot, i.e. the transitions of distinct ranges of
+     * slots can be learned concurrently without any locks. By default, the network is not partitioned.
+     */
+    virtual bool isPartitioned() const;
+
+    /**
+     * Updates the network by the transitions within a range of slots only. This method is only called if the network
+     * is partitioned. By default, the network is updated by all transitions once the range covers the population.
+     * @param parents    The individuals of the current generation.
+     * @param offsprings The individuals of the next generation.
+     * @param onset      The first slot of the range.
+     * @param offset     The number of slots within the range.
+     */
+    virtual void updateChunk(std::vector<Individual *> &parents,
+                             std::vector<Individual *> &offsprings,
+                             unsigned int onset,
+                             unsigned int offset);
+
+    /**
+     * Compresses the transitions from the parents to the offsprings into records that can be replayed later on.
+     * By default, the network cannot replay transitions, thus it has to be updated by the individuals themselves.
+     * @param  parents     The individuals of the current generation.
+     * @param  offsprings  The individuals of the next generation.
+     * @param  transitions The recorded transitions, one per slot.
+     * @return True if the transitions have been recorded, false otherwise.
+     */
+    virtual bool record(std::vector<Individual *> &parents,
+                        std::vector<Individual *> &offsprings,
+                        std::vector<Transition> &transitions) const;
+
+    /**
+     * Updates the network by a minibatch of recorded transitions. This method is only called if the network records
+     * transitions. By default, it does nothing.
+     * @param transitions The replayed transitions.
+     * @param errors      The temporal difference errors of the replayed transitions before the update, which are left
+     *                    empty if the network does not compute any.
+     */
+    virtual void learn(const std::vector<Transition> &transitions, std::vector<float> &errors);
+
+    /**
+     * Lets the network distribute the preprocessing of whole generations over a pool, e.g. the pool of the
+     * evolutionary system. Clones of the network are not attached to any pool.
+     */
+    virtual void attach(ThreadPool &pool);
+
     virtual EvolutionaryNetwork * clone() const = 0;
 
 protected:
     float learning_rate;
     float discount_factor;
+    ThreadPool *pool;
 
     EvolutionaryNetwork(const EvolutionaryNetwork &obj);
 
@@ -43,7 +105,7 @@ protected:
      * @param individuals
      * @return
      */
-    virtual std::vector<unsigned int> preprocess(std::vector<Individual *> &individuals) const = 0;
+    virtual std::vector<unsigned long long> preprocess(std::vector<Individual *> &individuals) const = 0;
 
 };
 
@@ -0,0 +1,49 @@
+#include <algorithm>
+#include <cmath>
+#include "PrioritizedReplayMemory.h"
+
+const float PrioritizedReplayMemory::EPSILON = 1e-3f;
+
+PrioritizedReplayMemory::PrioritizedReplayMemory(unsigned int capacity, float exponent)
+        : ReplayMemory(capacity), exponent(exponent), maximum(1), priorities(capacity) {}
+
+void PrioritizedReplayMemory::append(const std::vector<Transition> &transitions) {
+    if (getCapacity() == 0)
+        return;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto &transition : transitions)
+        priorities.set(insert(transition), maximum);
+}
+
+void PrioritizedReplayMemory::sample(std::vector<Transition> &minibatch,
+                                     std::vector<unsigned long> &indices,
+                                     unsigned int size,
+                                     Thread::Random &random) const {
+    minibatch.clear();
+    indices.clear();
+    std::lock_guard<std::mutex> lock(mutex);
+    if (transitions.empty())
+        return;
+
+    double segment = priorities.getTotal() / size;
+    for (unsigned int k = 0; k < size; k++) {
+        unsigned long index = priorities.find((k + random.sample()) * segment);
+        minibatch.push_back(transitions.at(index));
+        indices.push_back(index);
+    }
+}
+
+void PrioritizedReplayMemory::prioritize(const std::vector<unsigned long> &indices, const std::vector<float> &errors) {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (unsigned long k = 0; k < indices.size(); k++) {
+        double priority = std::pow(std::fabs(errors.at(k)) + EPSILON, exponent);
+        maximum = std::max(maximum, priority);
+        priorities.set(indices.at(k), priority);
+    }
+}
+
+double PrioritizedReplayMemory::getTotalPriority() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return priorities.getTotal();
+}
@@ -0,0 +1,58 @@
+#ifndef RATATOSKR_PRIORITIZEDREPLAYMEMORY_H
+#define RATATOSKR_PRIORITIZEDREPLAYMEMORY_H
+
+
+#include "ReplayMemory.h"
+#include "SumTree.h"
+
+/**
+ * Represents a replay memory that samples its transitions proportionally to their priorities, as described in "Tom
+ * Schaul et al.: Prioritized Experience Replay (2016)." The priority of a transition is given by (|e| + epsilon)^alpha
+ * with its last temporal difference error e, i.e. the network mostly learns the transitions that it predicts poorly.
+ * Stored transitions receive the maximum priority so far, thus each transition is likely to be replayed at least once.
+ * The priorities are kept in a sum tree, so that appending, sampling and prioritizing take O(log n) per transition.
+ *
+ * If several lanes share the memory, a transition might be overwritten between its sampling and its prioritization.
+ * In this case, the new transition merely starts with the priority of the old one.
+ *
+ * @author  Felix Voelker
+ * @version 0.1.0
+ * @since   27.1.2018
+ */
+class PrioritizedReplayMemory : public ReplayMemory {
+
+public:
+    /**
+     * Creates an empty memory.
+     * @param capacity Maximum number of stored transitions.
+     * @param exponent The exponent alpha that determines how much the errors are prioritized, i.e. 0 samples uniformly.
+     */
+    explicit PrioritizedReplayMemory(unsigned int capacity, float exponent);
+
+    void append(const std::vector<Transition> &transitions) override;
+
+    /**
+     * Samples a minibatch of stored transitions proportionally to their priorities, i.e. the total priority is split
+     * into equally sized segments, each of which yields one transition.
+     */
+    void sample(std::vector<Transition> &minibatch,
+                std::vector<unsigned long> &indices,
+                unsigned int size,
+                Thread::Random &random) const override;
+
+    void prioritize(const std::vector<unsigned long> &indices, const std::vector<float> &errors) override;
+
+    double getTotalPriority() const;
+
+private:
+    /** The offset of each priority, so that a transition without any error can still be sampled. */
+    static const float EPSILON;
+
+    float exponent;
+    double maximum;
+    SumTree priorities;
+
+};
+
+
+#endif //RATATOSKR_PRIORITIZEDREPLAYMEMORY_H
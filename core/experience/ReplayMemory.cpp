@@ -0,0 +1,54 @@
+#include "ReplayMemory.h"
+
+ReplayMemory::ReplayMemory(unsigned int capacity) : capacity(capacity), head(0) {
+    transitions.reserve(capacity);
+}
+
+void ReplayMemory::append(const std::vector<Transition> &transitions) {
+    if (capacity == 0)
+        return;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto &transition : transitions)
+        insert(transition);
+}
+
+void ReplayMemory::sample(std::vector<Transition> &minibatch,
+                          std::vector<unsigned long> &indices,
+                          unsigned int size,
+                          Thread::Random &random) const {
+    minibatch.clear();
+    indices.clear();
+    std::lock_guard<std::mutex> lock(mutex);
+    if (transitions.empty())
+        return;
+
+    for (unsigned int k = 0; k < size; k++) {
+        unsigned int index = random.sampleIntFromUniformDistribution(static_cast<unsigned int>(transitions.size()));
+        minibatch.push_back(transitions.at(index));
+        indices.push_back(index);
+    }
+}
+
+void ReplayMemory::prioritize(const std::vector<unsigned long> &indices, const std::vector<float> &errors) {}
+
+unsigned long ReplayMemory::getSize() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return transitions.size();
+}
+
+unsigned int ReplayMemory::getCapacity() const {
+    return capacity;
+}
+
+unsigned long ReplayMemory::insert(const Transition &transition) {
+    if (transitions.size() < capacity) {
+        transitions.push_back(transition);
+        return transitions.size() - 1;
+    }
+
+    unsigned long index = head;
+    transitions.at(index) = transition;
+    head = (head + 1) % capacity;
+    return index;
+}
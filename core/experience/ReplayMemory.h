@@ -0,0 +1,79 @@
+#ifndef RATATOSKR_REPLAYMEMORY_H
+#define RATATOSKR_REPLAYMEMORY_H
+
+
+#include <mutex>
+#include <vector>
+#include "Transition.h"
+#include "../util/Thread.h"
+
+/**
+ * Represents a bounded memory of past transitions that the evolutionary network learns from in minibatches, as
+ * described in "Long-Ji Lin: Self-Improving Reactive Agents Based on Reinforcement Learning, Planning and Teaching
+ * (1992)." The transitions are stored in a ring buffer, i.e. the oldest transition is overwritten once the memory is
+ * full. The memory is guarded by a mutex, so that several lanes may share it. By default, the transitions are sampled
+ * uniformly, whereas subclasses may prioritize them by the errors that the network reports while learning.
+ *
+ * @author  Felix Voelker
+ * @version 0.1.0
+ * @since   27.1.2018
+ */
+class ReplayMemory {
+
+public:
+    /**
+     * Creates an empty memory.
+     * @param capacity Maximum number of stored transitions.
+     */
+    explicit ReplayMemory(unsigned int capacity);
+    virtual ~ReplayMemory() = default;
+
+    ReplayMemory(const ReplayMemory &obj) = delete;
+    ReplayMemory & operator=(const ReplayMemory &obj) = delete;
+
+    /**
+     * Stores the given transitions, overwriting the oldest transitions if necessary.
+     */
+    virtual void append(const std::vector<Transition> &transitions);
+
+    /**
+     * Samples a minibatch of stored transitions uniformly with replacement.
+     * @param minibatch The sampled transitions, which is empty if the memory is empty.
+     * @param indices   The positions of the sampled transitions within the memory.
+     * @param size      The number of transitions to be sampled.
+     * @param random    The random module of the sampling thread.
+     */
+    virtual void sample(std::vector<Transition> &minibatch,
+                        std::vector<unsigned long> &indices,
+                        unsigned int size,
+                        Thread::Random &random) const;
+
+    /**
+     * Adjusts the priorities of sampled transitions to the errors that the network has reported for them. Since a
+     * uniform memory does not prioritize its transitions, it ignores the errors.
+     * @param indices The positions of the sampled transitions within the memory.
+     * @param errors  The temporal difference errors of the sampled transitions.
+     */
+    virtual void prioritize(const std::vector<unsigned long> &indices, const std::vector<float> &errors);
+
+    unsigned long getSize() const;
+    unsigned int getCapacity() const;
+
+protected:
+    std::vector<Transition> transitions;
+    mutable std::mutex mutex;
+
+    /**
+     * Stores a transition without locking the memory.
+     * @return The position of the stored transition.
+     */
+    unsigned long insert(const Transition &transition);
+
+private:
+    unsigned int capacity;
+    unsigned long head;
+
+};
+
+
+#endif //RATATOSKR_REPLAYMEMORY_H
@@ -1,10 +1,59 @@
 #include "Replayer.h"
 
-Replayer::Replayer(const core::Configuration &configuration, EvolutionaryNetwork &network)
-        : Singleton(configuration), network(network)
+Replayer::Replayer(const core::Configuration &configuration,
+                   EvolutionaryNetwork &network,
+                   ThreadPool &pool,
+                   ReplayMemory *memory,
+                   const Clock *clock)
+        : Singleton(configuration),
+          replaythreads(std::vector<Thread *>(configuration.getReplayerConfiguration().threads)),
+          pool(pool),
+          memory(memory),
+          clock(clock),
+          minibatch(configuration.getReplayerConfiguration().minibatch),
+          network(network)
 {
+    unsigned int onset  = 0;
+    unsigned int offset = configuration.getProblemConfiguration().popsize / configuration.getReplayerConfiguration().threads;
+    for (unsigned int k = 0; k < replaythreads.size() - 1; k++) {
+        replaythreads.at(k) = new Thread(onset, offset);
+        onset += offset;
+    }
+    replaythreads.at(replaythreads.size() - 1) = new Thread(onset, configuration.getProblemConfiguration().popsize - onset);
 }
 
-void Replayer::replay(Population &pop, std::vector<Individual *> &offsprings) const {
-    network.update(pop.getIndividuals(), offsprings);
-}
\ No newline at end of file
+Replayer::~Replayer() {
+    for (auto *thread : replaythreads)
+        delete thread;
+    std::vector<Thread *>().swap(replaythreads);
+}
+
+void Replayer::replay(Population &pop) const {
+    auto &parents = pop.getIndividuals();
+    auto &offsprings = pop.getOffsprings();
+    if (memory != nullptr && network.record(parents, offsprings, records)) {
+        Thread &thread = *replaythreads.at(0);
+        if (clock != nullptr)
+            thread.random.seed(*clock, 0, Thread::Random::REPLAY);
+        memory->append(records);
+        memory->sample(batch, indices, minibatch, thread.random);
+        network.learn(batch, errors);
+        if (errors.size() == indices.size())
+            memory->prioritize(indices, errors);
+        return;
+    }
+
+    if (replaythreads.size() == 1 || !network.isPartitioned()) {
+        network.update(parents, offsprings);
+        return;
+    }
+
+    std::vector<std::function<void()>> tasks(replaythreads.size());
+    for (unsigned int k = 0; k < replaythreads.size(); k++) {
+        Thread &thread = *replaythreads.at(k);
+        tasks.at(k) = [this, &parents, &offsprings, &thread] {
+            network.updateChunk(parents, offsprings, thread.getChunkOnset(), thread.getChunkOffset());
+        };
+    }
+    pool.execute(tasks);
+}
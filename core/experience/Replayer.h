@@ -3,9 +3,20 @@
 
 
 #include "EvolutionaryNetwork.h"
+#include "ReplayMemory.h"
+#include "../util/Thread.h"
+#include "../util/ThreadPool.h"
 
 /**
- * TODO: Comments
+ * The core module that drives the experience replay of an Neuro-Dynamic Evolutionary Algorithm (NDEA), i.e. it updates
+ * the evolutionary network by the transitions from the parents to the offspring of a generation. If the network is
+ * partitioned by slot, the population is split into several uniformly divided chunks that are concurrently learned
+ * by the thread pool of the evolutionary system. Otherwise, the network is updated by the calling thread at once.
+ *
+ * If a replay memory is given and the network records its transitions, the transitions of each generation are merely
+ * appended to the memory, whereas the network learns from a minibatch that is sampled from all past episodes. The
+ * memory determines the sampling strategy and is informed about the errors of the replayed transitions. If a clock is
+ * given, the minibatch is sampled with the random stream of the first slot.
  *
  * @author  Felix Voelker
  * @version 0.1.0
@@ -14,11 +25,33 @@
 class Replayer : public Singleton {
 
 public:
-    explicit Replayer(const core::Configuration &configuration, EvolutionaryNetwork &network);
-
-    void replay(Population &pop, std::vector<Individual *> &offsprings) const;
+    explicit Replayer(const core::Configuration &configuration,
+                      EvolutionaryNetwork &network,
+                      ThreadPool &pool,
+                      ReplayMemory *memory = nullptr,
+                      const Clock *clock = nullptr);
+    ~Replayer();
+
+    /**
+     * Updates the network by the transitions from the current individuals of the population to their offspring.
+     * @param pop State of evolutionary system's population.
+     */
+    void replay(Population &pop) const;
 
 protected:
+    std::vector<Thread *> replaythreads;
+    ThreadPool &pool;
+    ReplayMemory *memory;
+    const Clock *clock;
+    unsigned int minibatch;
+
+    /** Buffers of the recorded and the sampled transitions along with their positions in memory and errors. */
+    mutable std::vector<Transition> records;
+    mutable std::vector<Transition> batch;
+    mutable std::vector<unsigned long> indices;
+    mutable std::vector<float> errors;
+
+    /** Components */
     EvolutionaryNetwork &network;
 
 };
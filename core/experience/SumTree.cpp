@@ -0,0 +1,40 @@
+#include "SumTree.h"
+
+SumTree::SumTree(unsigned long capacity) : capacity(capacity), leaves(1) {
+    while (leaves < capacity)
+        leaves <<= 1;
+    nodes.resize(2 * leaves, 0);
+}
+
+void SumTree::set(unsigned long index, double priority) {
+    // Recomputing the sums instead of adding the difference keeps rounding errors from accumulating over time.
+    unsigned long node = leaves + index;
+    nodes.at(node) = priority;
+    for (node >>= 1; node > 0; node >>= 1)
+        nodes[node] = nodes[2 * node] + nodes[2 * node + 1];
+}
+
+double SumTree::get(unsigned long index) const {
+    return nodes.at(leaves + index);
+}
+
+unsigned long SumTree::find(double mass) const {
+    unsigned long node = 1;
+    while (node < leaves) {
+        node <<= 1;
+        // Rounding errors of the sums might lead into an empty subtree, thus the descent prefers the left child then.
+        if (mass >= nodes[node] && nodes[node + 1] > 0) {
+            mass -= nodes[node];
+            node += 1;
+        }
+    }
+    return node - leaves;
+}
+
+double SumTree::getTotal() const {
+    return nodes[1];
+}
+
+unsigned long SumTree::getCapacity() const {
+    return capacity;
+}
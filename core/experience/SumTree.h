@@ -0,0 +1,52 @@
+#ifndef RATATOSKR_SUMTREE_H
+#define RATATOSKR_SUMTREE_H
+
+
+#include <vector>
+
+/**
+ * Represents a binary tree whose leaves hold non-negative priorities and whose inner nodes hold the sum of their
+ * children, as described in "Tom Schaul et al.: Prioritized Experience Replay (2016)." Updating a priority and finding
+ * the leaf that covers a given prefix sum of all priorities both take O(log n). The tree is stored implicitly in an
+ * array, i.e. the children of node k are the nodes 2k and 2k + 1, whereas the leaves start at the first power of two
+ * that is not less than the capacity.
+ *
+ * @author  Felix Voelker
+ * @version 0.1.0
+ * @since   27.1.2018
+ */
+class SumTree {
+
+public:
+    /**
+     * Creates a tree whose priorities are all zero.
+     * @param capacity Number of leaves.
+     */
+    explicit SumTree(unsigned long capacity);
+
+    /**
+     * Sets the priority of a leaf and updates the sums along its path to the root.
+     */
+    void set(unsigned long index, double priority);
+
+    double get(unsigned long index) const;
+
+    /**
+     * Finds the leaf whose interval of the cumulated priorities contains the given mass.
+     * @param mass A value of [0, total), which is clamped to the last leaf with a positive priority otherwise.
+     * @return The index of the leaf.
+     */
+    unsigned long find(double mass) const;
+
+    double getTotal() const;
+    unsigned long getCapacity() const;
+
+private:
+    unsigned long capacity;
+    unsigned long leaves;
+    std::vector<double> nodes;
+
+};
+
+
+#endif //RATATOSKR_SUMTREE_H
@@ -0,0 +1,54 @@
+#include "SynchronizedNetwork.h"
+
+SynchronizedNetwork::SynchronizedNetwork(const core::Configuration &configuration, EvolutionaryNetwork *network)
+        : EvolutionaryNetwork(configuration), network(network) {}
+
+SynchronizedNetwork::~SynchronizedNetwork() {
+    delete network;
+}
+
+std::vector<float> SynchronizedNetwork::output(std::vector<Individual *> &individuals) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return network->output(individuals);
+}
+
+void SynchronizedNetwork::estimate(std::vector<Individual *> &individuals, unsigned int onset, unsigned int offset) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    network->estimate(individuals, onset, offset);
+}
+
+void SynchronizedNetwork::update(std::vector<Individual *> &parents, std::vector<Individual *> &offsprings) {
+    std::lock_guard<std::mutex> lock(mutex);
+    network->update(parents, offsprings);
+}
+
+bool SynchronizedNetwork::record(std::vector<Individual *> &parents,
+                                 std::vector<Individual *> &offsprings,
+                                 std::vector<Transition> &transitions) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return network->record(parents, offsprings, transitions);
+}
+
+void SynchronizedNetwork::learn(const std::vector<Transition> &transitions, std::vector<float> &errors) {
+    std::lock_guard<std::mutex> lock(mutex);
+    network->learn(transitions, errors);
+}
+
+void SynchronizedNetwork::attach(ThreadPool &pool) {
+    EvolutionaryNetwork::attach(pool);
+    network->attach(pool);
+}
+
+SynchronizedNetwork * SynchronizedNetwork::clone() const {
+    return new SynchronizedNetwork(*this);
+}
+
+SynchronizedNetwork::SynchronizedNetwork(const SynchronizedNetwork &obj) : EvolutionaryNetwork(obj) {
+    std::lock_guard<std::mutex> lock(obj.mutex);
+    this->network = obj.network->clone();
+}
+
+std::vector<unsigned long long> SynchronizedNetwork::preprocess(std::vector<Individual *> &individuals) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return network->preprocess(individuals);
+}
@@ -0,0 +1,50 @@
+#ifndef RATATOSKR_SYNCHRONIZEDNETWORK_H
+#define RATATOSKR_SYNCHRONIZEDNETWORK_H
+
+
+#include <mutex>
+#include "EvolutionaryNetwork.h"
+
+/**
+ * A decorator that serializes all accesses to an evolutionary network. It allows concurrent episodes to share a single
+ * network, i.e. each episode queries and updates the same cost approximation, while the decorated network itself does
+ * not need to be thread-safe.
+ *
+ * @author  Felix Voelker
+ * @version 0.1.0
+ * @since   27.1.2018
+ */
+class SynchronizedNetwork : public EvolutionaryNetwork {
+
+public:
+    /**
+     * Decorates a network, i.e. the decorator takes over its ownership.
+     * @param configuration The configuration of the evolutionary system.
+     * @param network       The network to be synchronized.
+     */
+    explicit SynchronizedNetwork(const core::Configuration &configuration, EvolutionaryNetwork *network);
+    ~SynchronizedNetwork();
+
+    std::vector<float> output(std::vector<Individual *> &individuals) const override;
+    void estimate(std::vector<Individual *> &individuals, unsigned int onset, unsigned int offset) const override;
+    void update(std::vector<Individual *> &parents, std::vector<Individual *> &offsprings) override;
+    bool record(std::vector<Individual *> &parents,
+                std::vector<Individual *> &offsprings,
+                std::vector<Transition> &transitions) const override;
+    void learn(const std::vector<Transition> &transitions, std::vector<float> &errors) override;
+    void attach(ThreadPool &pool) override;
+
+    SynchronizedNetwork * clone() const override;
+
+protected:
+    EvolutionaryNetwork *network;
+    mutable std::mutex mutex;
+
+    SynchronizedNetwork(const SynchronizedNetwork &obj);
+
+    std::vector<unsigned long long> preprocess(std::vector<Individual *> &individuals) const override;
+
+};
+
+
+#endif //RATATOSKR_SYNCHRONIZEDNETWORK_H
@@ -0,0 +1,22 @@
+#ifndef RATATOSKR_TRANSITION_H
+#define RATATOSKR_TRANSITION_H
+
+
+/**
+ * Represents a compact record of the transition from a parent to its offspring in a slot of the population. The states
+ * are given by the keys that the evolutionary network assigns to the individuals, thus the record does not refer to
+ * any individual and can be replayed after the population has moved on.
+ *
+ * @author  Felix Voelker
+ * @version 0.1.0
+ * @since   27.1.2018
+ */
+struct Transition {
+    unsigned long long state = 0;
+    unsigned long long next = 0;
+    float fitness = 0;
+    unsigned int slot = 0;
+};
+
+
+#endif //RATATOSKR_TRANSITION_H
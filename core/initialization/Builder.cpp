@@ -11,6 +11,7 @@ Builder::~Builder() {
 Individual * Builder::build(Thread &thread) const {
     auto ind = prototype->clone();
     initialize(*ind, thread);
+    ind->setEvaluated(false);
     return ind;
 }
 
@@ -1,9 +1,15 @@
 #include "Initializer.h"
 
-Initializer::Initializer(const core::Configuration &configuration, Builder &builder, unsigned int &epoch)
+Initializer::Initializer(const core::Configuration &configuration,
+                         Builder &builder,
+                         unsigned int &epoch,
+                         ThreadPool &pool,
+                         const Clock *clock)
         : Singleton(configuration),
           initthreads(std::vector<Thread *>(configuration.getInitializerConfiguration().threads)),
-          epoch(epoch)
+          epoch(epoch),
+          pool(pool),
+          clock(clock)
 {
     this->epochs = configuration.getEvolutionarySystemConfiguration().epochs;
     if (this->epochs > 1)
@@ -27,21 +33,19 @@ Initializer::~Initializer() {
 }
 
 void Initializer::initializePopulation(Population &pop) {
-    auto &individuals = pop.getIndividuals();
-
-    std::vector<std::thread> threads(initthreads.size());
+    std::vector<std::function<void()>> tasks(initthreads.size());
     for (unsigned int k = 0; k < initthreads.size(); k++) {
-        threads.at(k) = std::thread(&Initializer::initializeChunk, this, std::ref(individuals), std::ref(*initthreads.at(k)));
-    }
-
-    for (auto &thread : threads) {
-        thread.join();
+        Thread &thread = *initthreads.at(k);
+        tasks.at(k) = [this, &pop, &thread] { initializeChunk(pop, thread); };
     }
+    pool.execute(tasks);
 }
 
-void Initializer::initializeChunk(std::vector<Individual *> &individuals, Thread &thread) {
+void Initializer::initializeChunk(Population &pop, Thread &thread) {
     for (unsigned int k = 0; k < thread.getChunkOffset(); k++) {
-        individuals.at(k + thread.getChunkOnset()) = builder->build(thread);
-        individuals.at(k + thread.getChunkOnset())->getRelevance().setFraction(static_cast<float>(epoch) / epochs);
+        if (clock != nullptr)
+            thread.random.seed(*clock, k + thread.getChunkOnset(), Thread::Random::INITIALIZATION);
+        pop.setIndividual(k + thread.getChunkOnset(), builder->build(thread));
+        pop.getIndividuals().at(k + thread.getChunkOnset())->getRelevance().setFraction(static_cast<float>(epoch) / epochs);
     }
 }
\ No newline at end of file
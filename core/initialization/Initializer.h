@@ -5,11 +5,13 @@
 #include "Builder.h"
 #include "../representation/Population.h"
 #include "../util/Thread.h"
+#include "../util/ThreadPool.h"
 
 /**
  * The core module that drives the initialization phase of an Neuro-Dynamic Evolutionary Algorithm (NDEA).
  * This initialization is performed on the entire population that is split into several uniformly divided chunks.
- * These chunks are concurrently processed by the initialization threads whose number equals the amount of chunks.
+ * These chunks are concurrently processed by the thread pool of the evolutionary system, while each chunk maintains
+ * its own random module across generations. If a clock is given, each slot is built with its own random stream.
  *
  * @author  Felix Voelker
  * @version 0.1.0
@@ -18,7 +20,11 @@
 class Initializer : public Singleton {
 
 public:
-    explicit Initializer(const core::Configuration &configuration, Builder &builder, unsigned int &epoch);
+    explicit Initializer(const core::Configuration &configuration,
+                         Builder &builder,
+                         unsigned int &epoch,
+                         ThreadPool &pool,
+                         const Clock *clock = nullptr);
     ~Initializer();
 
     /**
@@ -31,17 +37,19 @@ protected:
     unsigned int &epoch;
     unsigned int epochs;
     std::vector<Thread *> initthreads;
+    ThreadPool &pool;
+    const Clock *clock;
 
     /** Components */
     Builder *builder;
 
     /**
-     * Initializes a given chunk of the population only. This function is called by each of the initialization threads
+     * Initializes a given chunk of the population only. This function is submitted to the thread pool for each chunk
      * and calls the evolutionary system's builder for each slot in the chunk.
-     * @param individuals The individuals within the population.
-     * @param thread      The initializing thread.
+     * @param pop    State of evolutionary system's population.
+     * @param thread The initializing thread.
      */
-    void initializeChunk(std::vector<Individual *> &individuals, Thread &thread);
+    void initializeChunk(Population &pop, Thread &thread);
 };
 
 
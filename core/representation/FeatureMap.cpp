@@ -1,3 +1,36 @@
+#include <algorithm>
 #include "FeatureMap.h"
 
-FeatureMap::FeatureMap(const core::Configuration &configuration) : Prototype(configuration) {}
\ No newline at end of file
+FeatureMap::FeatureMap(const core::Configuration &configuration) : Prototype(configuration) {}
+
+unsigned int FeatureMap::getDimension() const {
+    return 0;
+}
+
+void FeatureMap::extract(Individual &individual, float *features) const {}
+
+void FeatureMap::extractBatch(std::vector<Individual *> &individuals,
+                              unsigned int onset,
+                              unsigned int offset,
+                              Matrix &features) const {
+    features.resize(offset, getDimension());
+    for (unsigned int k = 0; k < offset; k++)
+        extract(*individuals.at(onset + k), features.row(k));
+}
+
+void FeatureMap::extractBatch(std::vector<Individual *> &individuals, Matrix &features, ThreadPool &pool) const {
+    auto size = static_cast<unsigned int>(individuals.size());
+    unsigned int chunks = std::max(std::min(pool.getSize(), size), 1u);
+    features.resize(size, getDimension());
+
+    std::vector<std::function<void()>> tasks(chunks);
+    for (unsigned int c = 0; c < chunks; c++) {
+        unsigned int onset = c * size / chunks;
+        unsigned int end = (c + 1) * size / chunks;
+        tasks.at(c) = [this, &individuals, &features, onset, end] {
+            for (unsigned int k = onset; k < end; k++)
+                extract(*individuals.at(k), features.row(k));
+        };
+    }
+    pool.execute(tasks);
+}
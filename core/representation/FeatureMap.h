@@ -2,7 +2,12 @@
 #define RATATOSKR_FEATUREMAP_H
 
 
+#include <vector>
+#include "../util/Matrix.h"
 #include "../util/Prototype.h"
+#include "../util/ThreadPool.h"
+
+class Individual;
 
 /**
  * The abstract base class for an individual's feature map in a Neuro-Dynamic Evolutionary Algorithm (NDEA), i.e.
@@ -11,6 +16,10 @@
  * has to take the individual's representation into account in order to provide the evolutionary network with
  * highly informative data.
  *
+ * The features of a batch of individuals are extracted into the rows of an aligned matrix, so that the network can
+ * consume a single contiguous block instead of visiting the individuals one by one. Since each row starts at its own
+ * cache line, distinct rows can be written concurrently by the workers of a thread pool.
+ *
  * @author  Felix Voelker
  * @version 0.1.0
  * @since   25.1.2018
@@ -20,6 +29,36 @@ class FeatureMap : public Prototype {
 public:
     explicit FeatureMap(const core::Configuration &configuration);
 
+    /**
+     * Returns the number of dense features per individual. By default, the map does not provide any dense features.
+     */
+    virtual unsigned int getDimension() const;
+
+    /**
+     * Writes the dense features of an individual. By default, the map does not provide any dense features.
+     * @param individual The individual whose genotype is mapped.
+     * @param features   The row of the feature matrix, which holds at least getDimension() zeros.
+     */
+    virtual void extract(Individual &individual, float *features) const;
+
+    /**
+     * Extracts the features of the individuals within a range into the rows of a matrix.
+     * @param individuals The individuals, e.g. the population.
+     * @param onset       The first individual of the range.
+     * @param offset      The number of individuals within the range, i.e. the number of rows of the matrix.
+     * @param features    The feature matrix, which is reshaped accordingly.
+     */
+    void extractBatch(std::vector<Individual *> &individuals,
+                      unsigned int onset,
+                      unsigned int offset,
+                      Matrix &features) const;
+
+    /**
+     * Extracts the features of all individuals into the rows of a matrix, whereas the rows are split into a chunk per
+     * worker of the pool.
+     */
+    void extractBatch(std::vector<Individual *> &individuals, Matrix &features, ThreadPool &pool) const;
+
     virtual FeatureMap * clone() const = 0;
 };
 
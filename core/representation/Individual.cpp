@@ -12,6 +12,14 @@ Individual::~Individual() {
     delete relevance;
 }
 
+bool Individual::assign(const Individual &obj) {
+    return false;
+}
+
+bool Individual::hash(unsigned long long &key) const {
+    return false;
+}
+
 FeatureMap & Individual::getFeaturemap() const {
     return *featuremap;
 }
@@ -29,6 +37,12 @@ void Individual::setEvaluated(const bool evaluated) {
 }
 
 Individual::Individual(const Individual &obj) : Prototype(obj) {
+    evaluated = obj.evaluated;
     featuremap = obj.featuremap->clone();
     relevance = obj.relevance->clone();
-}
\ No newline at end of file
+}
+
+void Individual::assignState(const Individual &obj) {
+    relevance->assign(*obj.relevance);
+    evaluated = obj.evaluated;
+}
@@ -28,9 +28,30 @@ public:
 
     Individual * clone() const = 0;
 
+    /**
+     * Overwrites this individual with a copy of another individual while reusing the storage of this individual,
+     * e.g. its chromosome, feature map and relevance. Individuals that do not support such a reuse are simply cloned
+     * by the individual pool.
+     * @param obj The individual to be copied.
+     * @return True if the individual has been overwritten, false if the representations are incompatible.
+     */
+    virtual bool assign(const Individual &obj);
+
+    /**
+     * Computes a hash of the genotype that identifies the individual within the fitness cache of the evaluator.
+     * Individuals that do not supply such a hash are always evaluated.
+     * @param key The hash of the genotype.
+     * @return True if the hash has been computed, false if the representation does not support hashing.
+     */
+    virtual bool hash(unsigned long long &key) const;
+
     FeatureMap & getFeaturemap() const;
     Relevance  & getRelevance() const;
 
+    /**
+     * Determines whether the fitness of the individual is up to date. The evaluation state is preserved by copies,
+     * so any operator that actually modifies the genes of the individual has to reset it.
+     */
     bool isEvaluated() const;
     void setEvaluated(bool evaluated);
 
@@ -42,6 +63,11 @@ protected:
 
     Individual(const Individual &obj);
 
+    /**
+     * Overwrites the representation-independent state of this individual, i.e. as done by the copy constructor.
+     */
+    void assignState(const Individual &obj);
+
 };
 
 
@@ -0,0 +1,27 @@
+#include "IndividualPool.h"
+
+IndividualPool::~IndividualPool() {
+    for (auto *individual : individuals)
+        delete individual;
+    std::vector<Individual *>().swap(individuals);
+}
+
+Individual * IndividualPool::acquire(const Individual &original) {
+    while (!individuals.empty()) {
+        Individual *individual = individuals.back();
+        individuals.pop_back();
+        if (individual->assign(original))
+            return individual;
+        delete individual;
+    }
+    return original.clone();
+}
+
+void IndividualPool::release(Individual *individual) {
+    if (individual != nullptr)
+        individuals.push_back(individual);
+}
+
+unsigned long IndividualPool::getSize() const {
+    return individuals.size();
+}
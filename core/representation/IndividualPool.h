@@ -0,0 +1,48 @@
+#ifndef RATATOSKR_INDIVIDUALPOOL_H
+#define RATATOSKR_INDIVIDUALPOOL_H
+
+
+#include <vector>
+#include "Individual.h"
+
+/**
+ * Represents a pool of recycled individuals that belongs to a single thread. Instead of deleting the exterminated
+ * parents of a generation and cloning new offsprings from scratch, the parents are released into the pool and their
+ * storage is reused when the next offsprings are acquired. Accordingly, the breeding threads do not compete for the
+ * global allocator at each generation. A pool must not be shared by several threads.
+ *
+ * @author  Felix Voelker
+ * @version 0.1.0
+ * @since   27.1.2018
+ */
+class IndividualPool {
+
+public:
+    explicit IndividualPool() = default;
+    ~IndividualPool();
+
+    IndividualPool(const IndividualPool &obj) = delete;
+    IndividualPool & operator=(const IndividualPool &obj) = delete;
+
+    /**
+     * Returns a copy of the given individual. The copy reuses a recycled individual if available and is cloned
+     * otherwise.
+     * @param original The individual to be copied.
+     */
+    Individual * acquire(const Individual &original);
+
+    /**
+     * Releases an individual into the pool, i.e. the pool takes over its ownership.
+     * @param individual The individual to be recycled.
+     */
+    void release(Individual *individual);
+
+    unsigned long getSize() const;
+
+private:
+    std::vector<Individual *> individuals;
+
+};
+
+
+#endif //RATATOSKR_INDIVIDUALPOOL_H
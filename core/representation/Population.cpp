@@ -1,59 +1,155 @@
+#include <utility>
+#include <typeinfo>
 #include "Population.h"
 
-Population::Population(const core::Configuration &configuration) : Singleton(configuration) {
-    individuals = std::vector<Individual *>(configuration.getProblemConfiguration().popsize);
+Population::Population(const core::Configuration &configuration)
+        : Singleton(configuration),
+          generations{Generation(configuration.getProblemConfiguration().popsize),
+                      Generation(configuration.getProblemConfiguration().popsize)},
+          front(&generations[0]),
+          back(&generations[1])
+{
 }
 
 Population::~Population() {
-    for (auto *individual : individuals) {
-        delete individual;
+    for (auto &generation : generations) {
+        for (auto *individual : generation.individuals) {
+            delete individual;
+        }
+        std::vector<Individual *>().swap(generation.individuals);
     }
-    std::vector<Individual *>().swap(individuals);
 }
 
 void Population::exterminate() {
-    for (auto &individual : individuals) {
+    for (auto &individual : front->individuals) {
         delete individual;
         individual = nullptr;
     }
 }
 
 Individual * Population::bestIndividual() const {
-    Individual *best_individual = individuals.at(0);
-    for (unsigned int k = 1; k < individuals.size(); k++) {
-        if (individuals.at(k)->getRelevance() > best_individual->getRelevance())
-            best_individual = individuals.at(k);
+    if (!conventional()) {
+        Individual *best_individual = front->individuals.at(0);
+        for (unsigned int k = 1; k < front->individuals.size(); k++) {
+            if (front->individuals.at(k)->getRelevance() > best_individual->getRelevance())
+                best_individual = front->individuals.at(k);
+        }
+        return best_individual;
+    }
+
+    unsigned int best = 0;
+    float best_relevance = relevance(0);
+    for (unsigned int k = 1; k < front->individuals.size(); k++) {
+        float r = relevance(k);
+        if (r < best_relevance) {
+            best = k;
+            best_relevance = r;
+        }
     }
-    return best_individual;
+    return front->individuals.at(best);
 }
 
 Individual * Population::averageIndividual() const {
-    float average_cost = individuals.at(0)->getRelevance().getCost();
-    float average_fitness = individuals.at(0)->getRelevance().getFitness();
-    for (unsigned int k = 1; k < individuals.size(); k++) {
-        average_cost += individuals.at(k)->getRelevance().getCost();
-        average_fitness += individuals.at(k)->getRelevance().getFitness();
-    }
-    Individual *average_individual = individuals.at(0)->clone();
-    average_individual->getRelevance().setCost(average_cost / individuals.size());
-    average_individual->getRelevance().setFitness(average_fitness / individuals.size());
+    float average_cost = 0;
+    float average_fitness = 0;
+    for (unsigned int k = 0; k < front->individuals.size(); k++) {
+        average_cost += front->costs[k];
+        average_fitness += front->fitnesses[k];
+    }
+    Individual *average_individual = front->individuals.at(0)->clone();
+    average_individual->getRelevance().setCost(average_cost / front->individuals.size());
+    average_individual->getRelevance().setFitness(average_fitness / front->individuals.size());
     return average_individual;
 }
 
 Individual * Population::worstIndividual() const {
-    Individual *worst_individual = individuals.at(0);
-    for (unsigned int k = 1; k < individuals.size(); k++) {
-        if (individuals.at(k)->getRelevance() < worst_individual->getRelevance())
-            worst_individual = individuals.at(k);
+    if (!conventional()) {
+        Individual *worst_individual = front->individuals.at(0);
+        for (unsigned int k = 1; k < front->individuals.size(); k++) {
+            if (front->individuals.at(k)->getRelevance() < worst_individual->getRelevance())
+                worst_individual = front->individuals.at(k);
+        }
+        return worst_individual;
     }
-    return worst_individual;
+
+    unsigned int worst = 0;
+    float worst_relevance = relevance(0);
+    for (unsigned int k = 1; k < front->individuals.size(); k++) {
+        float r = relevance(k);
+        if (r > worst_relevance) {
+            worst = k;
+            worst_relevance = r;
+        }
+    }
+    return front->individuals.at(worst);
+}
+
+void Population::setIndividual(unsigned int slot, Individual *individual) {
+    front->place(slot, individual);
+}
+
+void Population::setOffspring(unsigned int slot, Individual *offspring) {
+    back->place(slot, offspring);
+}
+
+void Population::swap() {
+    std::swap(front, back);
 }
 
 std::vector<Individual *> & Population::getIndividuals() {
-    std::vector<Individual *> &individuals = this->individuals;
+    std::vector<Individual *> &individuals = front->individuals;
     return individuals;
 }
 
 void Population::setIndividuals(std::vector<Individual *> &individuals) {
-    this->individuals = individuals;
-}
\ No newline at end of file
+    for (unsigned int k = 0; k < individuals.size(); k++) {
+        setIndividual(k, individuals.at(k));
+    }
+}
+
+std::vector<Individual *> & Population::getOffsprings() {
+    return back->individuals;
+}
+
+const std::vector<float> & Population::getCosts() const {
+    return front->costs;
+}
+
+const std::vector<float> & Population::getFitnesses() const {
+    return front->fitnesses;
+}
+
+const std::vector<float> & Population::getFractions() const {
+    return front->fractions;
+}
+
+float Population::relevance(unsigned int slot) const {
+    return (1 - front->fractions[slot]) * front->fitnesses[slot] + front->fractions[slot] * front->costs[slot];
+}
+
+bool Population::conventional() const {
+    return typeid(front->individuals.at(0)->getRelevance()) == typeid(Relevance);
+}
+
+Population::Generation::Generation(unsigned long popsize)
+        : individuals(popsize, nullptr),
+          costs(popsize, 0),
+          fitnesses(popsize, 0),
+          fractions(popsize, 0)
+{
+}
+
+void Population::Generation::place(unsigned int slot, Individual *individual) {
+    Individual *&occupant = individuals.at(slot);
+    if (occupant == individual)
+        return;
+    if (occupant != nullptr)
+        occupant->getRelevance().unbind();
+
+    occupant = individual;
+    if (individual != nullptr) {
+        if (individual->getRelevance().isBound())
+            individual->getRelevance().unbind();
+        individual->getRelevance().bind(&costs.at(slot), &fitnesses.at(slot), &fractions.at(slot));
+    }
+}
@@ -7,7 +7,12 @@
 
 /**
  * Represents the population as the state of an evolutionary system. Accordingly, the class incorporates a set of
- * individuals and provides the functionality for maintainance and comparison on the population level.
+ * individuals and provides the functionality for maintainance and comparison on the population level. The relevance
+ * values of the individuals are stored as packed arrays indexed by slot, i.e. the relevance of each individual is a
+ * view on its slot. Accordingly, population-wide reductions and selections are linear scans over these arrays.
+ *
+ * The population holds two generations of slots, i.e. the current individuals in front and their offspring in back.
+ * Both generations are allocated once, and the offspring becomes the current generation by swapping the two.
  *
  * @author  Felix Voelker
  * @version 0.1.0
@@ -25,7 +30,9 @@ public:
     void exterminate();
 
     /**
-     * Finds the individual with the best relevance value within the population.
+     * Finds the individual with the best relevance value within the population. If the individuals use the base
+     * Relevance, it scans the packed arrays for the conventional relevance, i.e. (1 - fraction) * fitness + fraction *
+     * cost. Otherwise it relies on the comparison operators of the relevance, since these might be overridden.
      * @param fraction Decimal number within the interval [0,1] with 0 being fitness only and 1 being cost only.
      * Out of scope numbers are projected on the boundary of the interval.
      */
@@ -37,17 +44,80 @@ public:
     Individual * averageIndividual() const;
 
     /**
-     * Finds the individual with the worst relevance value within the population.
+     * Finds the individual with the worst relevance value within the population. Like bestIndividual, it only scans the
+     * packed arrays if the individuals use the base Relevance.
      * @param fraction Decimal number within the interval [0,1] with 0 being fitness only and 1 being cost only.
      * Out of scope numbers are projected on the boundary of the interval.
      */
     Individual * worstIndividual() const;
 
+    /**
+     * Places an individual into a slot of the population and binds its relevance to the slot. The previous occupant
+     * of the slot is unbound but not deleted, i.e. it has to be alive or null. Distinct slots may be set concurrently.
+     * @param slot       The slot of the individual.
+     * @param individual The individual to be placed or null to empty the slot.
+     */
+    void setIndividual(unsigned int slot, Individual *individual);
+
+    /**
+     * Places an offspring into a slot of the back generation just like setIndividual does for the front generation.
+     * @param slot      The slot of the offspring.
+     * @param offspring The offspring to be placed or null to empty the slot.
+     */
+    void setOffspring(unsigned int slot, Individual *offspring);
+
+    /**
+     * Makes the offspring the current generation and vice versa. Neither individuals nor relevance values are moved,
+     * since each generation keeps the slots that its individuals are bound to.
+     */
+    void swap();
+
+    /**
+     * Returns the individuals of the population. The slots must only be assigned via setIndividual.
+     */
     std::vector<Individual *> & getIndividuals();
     void setIndividuals(std::vector<Individual *> &individuals);
 
+    /**
+     * Returns the offspring of the population. The slots must only be assigned via setOffspring.
+     */
+    std::vector<Individual *> & getOffsprings();
+
+    /**
+     * Checks whether the individuals use the base Relevance, i.e. whether the conventional relevance of the packed
+     * arrays orders them like their comparison operators do.
+     */
+    bool conventional() const;
+
+    const std::vector<float> & getCosts() const;
+    const std::vector<float> & getFitnesses() const;
+    const std::vector<float> & getFractions() const;
+
 private:
-    std::vector<Individual *> individuals;
+    struct Generation {
+        std::vector<Individual *> individuals;
+
+        /** The packed relevance arrays, indexed by slot. */
+        std::vector<float> costs;
+        std::vector<float> fitnesses;
+        std::vector<float> fractions;
+
+        explicit Generation(unsigned long popsize);
+
+        /**
+         * Places an individual into a slot of the generation and binds its relevance to the slot.
+         */
+        void place(unsigned int slot, Individual *individual);
+    };
+
+    Generation generations[2];
+    Generation *front;
+    Generation *back;
+
+    /**
+     * Computes the conventional relevance of the individual at the given slot.
+     */
+    float relevance(unsigned int slot) const;
 
 };
 
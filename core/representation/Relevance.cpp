@@ -1,17 +1,18 @@
 #include "Relevance.h"
 
-Relevance::Relevance(const core::Configuration &configuration) : Prototype(configuration) {}
+Relevance::Relevance(const core::Configuration &configuration)
+        : Prototype(configuration), cost(&values[0]), fitness(&values[1]), fraction(&values[2]) {}
 
 float Relevance::error(float discount_factor, float fitness, float next) const {
-    return fitness + discount_factor*next - cost;
+    return fitness + discount_factor*next - *cost;
 }
 
 bool Relevance::isIdeal() const {
-    return fitness == 0;
+    return *fitness == 0;
 }
 
 float Relevance::relevance() const {
-    return (1 - fraction) * fitness + fraction * cost;
+    return (1 - *fraction) * *fitness + *fraction * *cost;
 }
 
 float Relevance::adjustedRelevance() const {
@@ -46,34 +47,70 @@ Relevance* Relevance::clone() const {
     return new Relevance(*this);
 }
 
+void Relevance::assign(const Relevance &obj) {
+    *this->cost = *obj.cost;
+    *this->fitness = *obj.fitness;
+    *this->fraction = *obj.fraction;
+}
+
+Relevance & Relevance::operator=(const Relevance &obj) {
+    if (this != &obj)
+        assign(obj);
+    return *this;
+}
+
+void Relevance::bind(float *cost, float *fitness, float *fraction) {
+    *cost = *this->cost;
+    *fitness = *this->fitness;
+    *fraction = *this->fraction;
+    this->cost = cost;
+    this->fitness = fitness;
+    this->fraction = fraction;
+}
+
+void Relevance::unbind() {
+    values[0] = *cost;
+    values[1] = *fitness;
+    values[2] = *fraction;
+    cost = &values[0];
+    fitness = &values[1];
+    fraction = &values[2];
+}
+
+bool Relevance::isBound() const {
+    return cost != &values[0];
+}
+
 float Relevance::getCost() const {
-    return cost;
+    return *cost;
 }
 
 float Relevance::getFitness() const {
-    return fitness;
+    return *fitness;
 }
 
 float Relevance::getFraction() const {
-    return fraction;
+    return *fraction;
 }
 
 void Relevance::setCost(float cost) {
-    this->cost = cost;
+    *this->cost = cost;
 }
 
 void Relevance::setFitness(float fitness) {
-    this->fitness = fitness;
+    *this->fitness = fitness;
 }
 
 void Relevance::setFraction(float fraction) {
     fraction = fraction < 0? 0 : fraction;
     fraction = fraction > 1? 1 : fraction;
-    this->fraction = fraction;
+    *this->fraction = fraction;
 }
 
-Relevance::Relevance(const Relevance &obj) : Prototype(obj) {
-    this->cost = obj.cost;
-    this->fitness = obj.fitness;
-    this->fraction = obj.fraction;
+Relevance::Relevance(const Relevance &obj)
+        : Prototype(obj), cost(&values[0]), fitness(&values[1]), fraction(&values[2])
+{
+    values[0] = *obj.cost;
+    values[1] = *obj.fitness;
+    values[2] = *obj.fraction;
 }
\ No newline at end of file
@@ -10,6 +10,9 @@
  * Programming: On the Programming of Computers by Means of Natural Selection (1992)" and the cost-to-go as described
  * in "Dimitri P. Bertsekas, John Tsitsiklis. Neuro-Dynamic Programming (1996)".
  *
+ * As long as its individual lives within a population, the relevance is bound to the population's slot and acts as a
+ * view on the packed relevance arrays of the population. Otherwise, it stores its values itself.
+ *
  * @author  Felix Voelker
  * @version 0.1.0
  * @since   25.1.2018
@@ -54,6 +57,28 @@ public:
 
     virtual Relevance * clone() const;
 
+    /**
+     * Overwrites the values of this relevance with the values of another one, i.e. it acts like a copy but does not
+     * allocate a new relevance.
+     * @param obj The relevance to be copied.
+     */
+    virtual void assign(const Relevance &obj);
+
+    Relevance & operator=(const Relevance &obj);
+
+    /**
+     * Binds the relevance to external storage, e.g. a slot of the population's relevance arrays. The current values
+     * are moved into the given storage.
+     */
+    void bind(float *cost, float *fitness, float *fraction);
+
+    /**
+     * Moves the values from the bound storage back into the relevance itself.
+     */
+    void unbind();
+
+    bool isBound() const;
+
     float getCost() const;
     float getFitness() const;
     float getFraction() const;
@@ -62,11 +87,15 @@ public:
     void  setFraction(float fraction);
 
 protected:
-    float cost;
-    float fitness;
-    float fraction;
+    float *cost;
+    float *fitness;
+    float *fraction;
 
     Relevance(const Relevance &obj);
+
+private:
+    /** The storage of an unbound relevance, i.e. its cost, fitness and fraction. */
+    float values[3] = {0, 0, 0};
 };
 
 
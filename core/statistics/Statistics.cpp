@@ -1,6 +1,13 @@
+#include <algorithm>
 #include "Statistics.h"
 
+Statistics::Statistics(const core::Configuration &configuration, ThreadPool &pool) : Statistics(configuration) {
+    this->pool = &pool;
+}
+
 Statistics::Statistics(const core::Configuration &configuration) {
+    series = configuration.getStatisticsConfiguration().series;
+    threads = configuration.getStatisticsConfiguration().threads;
     epochs = configuration.getEvolutionarySystemConfiguration().epochs;
     episodes = configuration.getEvolutionarySystemConfiguration().episodes;
     generations = configuration.getEvolutionarySystemConfiguration().generations;
@@ -46,9 +53,83 @@ Statistics::~Statistics() {
 }
 
 void Statistics::record(Population &pop, const unsigned int epoch, const unsigned int generation) {
-    recordCost(pop, epoch, generation);
-    recordFitness(pop, epoch, generation);
-    recordRelevance(pop, epoch, generation);
+    auto size = static_cast<unsigned int>(pop.getCosts().size());
+    unsigned int ranges = pool == nullptr ? 1 : std::max(1u, std::min(threads, size));
+
+    Reduction reduction;
+    if (ranges == 1) {
+        reduction = reduce(pop, 0, size);
+    } else {
+        std::vector<Reduction> partials(ranges);
+        std::vector<std::function<void()>> tasks(ranges);
+        for (unsigned int k = 0; k < ranges; k++) {
+            unsigned int onset = size * k / ranges;
+            unsigned int offset = size * (k + 1) / ranges - onset;
+            tasks.at(k) = [this, &pop, &partials, k, onset, offset] { partials.at(k) = reduce(pop, onset, offset); };
+        }
+        pool->execute(tasks);
+
+        reduction = partials.at(0);
+        for (unsigned int k = 1; k < ranges; k++)
+            merge(pop, reduction, partials.at(k));
+    }
+
+    const std::vector<float> &costs = pop.getCosts();
+    const std::vector<float> &fitnesses = pop.getFitnesses();
+    auto mean_cost = static_cast<float>(reduction.total_cost / size);
+    auto mean_fitness = static_cast<float>(reduction.total_fitness / size);
+    float fraction = pop.getFractions().at(0);
+
+    auto add = [this, epoch, generation](Series selected, std::vector<std::vector<float>> &data, float value) {
+        if (series & selected)
+            data.at(epoch).at(generation) += value / episodes;
+    };
+    add(BEST_COST, best_cost, reduction.best_cost);
+    add(AVERAGE_COST, average_cost, mean_cost);
+    add(WORST_COST, worst_cost, reduction.worst_cost);
+    add(BEST_FITNESS, best_fitness, reduction.best_fitness);
+    add(AVERAGE_FITNESS, average_fitness, mean_fitness);
+    add(WORST_FITNESS, worst_fitness, reduction.worst_fitness);
+    add(BEST_RELEVANCE, best_relevance, reduction.best_relevance);
+    add(AVERAGE_RELEVANCE, average_relevance, (1 - fraction) * mean_fitness + fraction * mean_cost);
+    add(WORST_RELEVANCE, worst_relevance, reduction.worst_relevance);
+    add(MOST_RELEVANT_COST, most_relevant_cost, costs.at(reduction.most_relevant));
+    add(LEAST_RELEVANT_COST, least_relevant_cost, costs.at(reduction.least_relevant));
+    add(MOST_RELEVANT_FITNESS, most_relevant_fitness, fitnesses.at(reduction.most_relevant));
+    add(LEAST_RELEVANT_FITNESS, least_relevant_fitness, fitnesses.at(reduction.least_relevant));
+}
+
+void Statistics::merge(const Statistics &other) {
+    auto add = [](std::vector<std::vector<float>> &data, const std::vector<std::vector<float>> &other_data) {
+        for (unsigned int k = 0; k < data.size(); k++) {
+            for (unsigned int l = 0; l < data.at(k).size(); l++)
+                data.at(k).at(l) += other_data.at(k).at(l);
+        }
+    };
+    add(best_cost, other.best_cost);
+    add(average_cost, other.average_cost);
+    add(worst_cost, other.worst_cost);
+    add(best_fitness, other.best_fitness);
+    add(average_fitness, other.average_fitness);
+    add(worst_fitness, other.worst_fitness);
+    add(best_relevance, other.best_relevance);
+    add(average_relevance, other.average_relevance);
+    add(worst_relevance, other.worst_relevance);
+    add(most_relevant_cost, other.most_relevant_cost);
+    add(least_relevant_cost, other.least_relevant_cost);
+    add(most_relevant_fitness, other.most_relevant_fitness);
+    add(least_relevant_fitness, other.least_relevant_fitness);
+}
+
+void Statistics::clear() {
+    for (auto *data : { &best_cost, &average_cost, &worst_cost,
+                        &best_fitness, &average_fitness, &worst_fitness,
+                        &best_relevance, &average_relevance, &worst_relevance,
+                        &most_relevant_cost, &least_relevant_cost,
+                        &most_relevant_fitness, &least_relevant_fitness }) {
+        for (auto &series : *data)
+            std::fill(series.begin(), series.end(), 0.0f);
+    }
 }
 
 std::vector<float> Statistics::bestCost(unsigned int epoch) const {
@@ -115,54 +196,67 @@ unsigned int Statistics::getGenerations() {
     return generations;
 }
 
-void Statistics::recordCost(Population &pop, unsigned int epoch, unsigned int generation) {
-    std::vector<Individual *> individuals = pop.getIndividuals();
-    float best = individuals.at(0)->getRelevance().getCost();
-    float worst = individuals.at(0)->getRelevance().getCost();
-    for (unsigned int k = 1; k < individuals.size(); k++) {
-        if (individuals.at(k)->getRelevance().getCost() < best) {
-            best = individuals.at(k)->getRelevance().getCost();
+Statistics::Reduction Statistics::reduce(Population &pop, unsigned int onset, unsigned int offset) const {
+    const float *costs = pop.getCosts().data();
+    const float *fitnesses = pop.getFitnesses().data();
+    const float *fractions = pop.getFractions().data();
+    bool conventional = pop.conventional();
+
+    Reduction reduction;
+    reduction.best_cost = reduction.worst_cost = costs[onset];
+    reduction.best_fitness = reduction.worst_fitness = fitnesses[onset];
+    reduction.best_relevance = reduction.worst_relevance = (1 - fractions[onset]) * fitnesses[onset] + fractions[onset] * costs[onset];
+    reduction.most_relevant = reduction.least_relevant = onset;
+
+    for (unsigned int k = onset; k < onset + offset; k++) {
+        float cost = costs[k];
+        float fitness = fitnesses[k];
+        float relevance = (1 - fractions[k]) * fitness + fractions[k] * cost;
+
+        reduction.total_cost += cost;
+        reduction.total_fitness += fitness;
+        reduction.best_cost = cost < reduction.best_cost ? cost : reduction.best_cost;
+        reduction.worst_cost = cost > reduction.worst_cost ? cost : reduction.worst_cost;
+        reduction.best_fitness = fitness < reduction.best_fitness ? fitness : reduction.best_fitness;
+        reduction.worst_fitness = fitness > reduction.worst_fitness ? fitness : reduction.worst_fitness;
+        if (conventional ? relevance < reduction.best_relevance : moreRelevant(pop, k, reduction.most_relevant)) {
+            reduction.best_relevance = relevance;
+            reduction.most_relevant = k;
         }
-        if (individuals.at(k)->getRelevance().getCost() > worst) {
-            worst = individuals.at(k)->getRelevance().getCost();
+        if (conventional ? relevance > reduction.worst_relevance : lessRelevant(pop, k, reduction.least_relevant)) {
+            reduction.worst_relevance = relevance;
+            reduction.least_relevant = k;
         }
     }
+    return reduction;
+}
 
-    best_cost.at(epoch).at(generation) += best / episodes;
-    Individual *average_individual = pop.averageIndividual();
-    average_cost.at(epoch).at(generation) += average_individual->getRelevance().getCost() / episodes;
-    delete average_individual;
-    worst_cost.at(epoch).at(generation) += worst / episodes;
-    most_relevant_cost.at(epoch).at(generation) += pop.bestIndividual()->getRelevance().getCost() / episodes;
-    least_relevant_cost.at(epoch).at(generation) += pop.worstIndividual()->getRelevance().getCost() / episodes;
-}
-
-void Statistics::recordFitness(Population &pop, unsigned int epoch, unsigned int generation) {
-    std::vector<Individual *> individuals = pop.getIndividuals();
-    float best = individuals.at(0)->getRelevance().getFitness();
-    float worst = individuals.at(0)->getRelevance().getFitness();
-    for (unsigned int k = 1; k < individuals.size(); k++) {
-        if (individuals.at(k)->getRelevance().getFitness() < best) {
-            best = individuals.at(k)->getRelevance().getFitness();
-        }
-        if (individuals.at(k)->getRelevance().getFitness() > worst) {
-            worst = individuals.at(k)->getRelevance().getFitness();
-        }
+void Statistics::merge(Population &pop, Reduction &reduction, const Reduction &partial) const {
+    bool conventional = pop.conventional();
+    reduction.total_cost += partial.total_cost;
+    reduction.total_fitness += partial.total_fitness;
+    reduction.best_cost = std::min(reduction.best_cost, partial.best_cost);
+    reduction.worst_cost = std::max(reduction.worst_cost, partial.worst_cost);
+    reduction.best_fitness = std::min(reduction.best_fitness, partial.best_fitness);
+    reduction.worst_fitness = std::max(reduction.worst_fitness, partial.worst_fitness);
+    if (conventional ? partial.best_relevance < reduction.best_relevance
+                     : moreRelevant(pop, partial.most_relevant, reduction.most_relevant)) {
+        reduction.best_relevance = partial.best_relevance;
+        reduction.most_relevant = partial.most_relevant;
     }
+    if (conventional ? partial.worst_relevance > reduction.worst_relevance
+                     : lessRelevant(pop, partial.least_relevant, reduction.least_relevant)) {
+        reduction.worst_relevance = partial.worst_relevance;
+        reduction.least_relevant = partial.least_relevant;
+    }
+}
 
-    best_fitness.at(epoch).at(generation) += best / episodes;
-    Individual *average_individual = pop.averageIndividual();
-    average_fitness.at(epoch).at(generation) += average_individual->getRelevance().getFitness() / episodes;
-    delete average_individual;
-    worst_fitness.at(epoch).at(generation) += worst / episodes;
-    most_relevant_fitness.at(epoch).at(generation) += pop.bestIndividual()->getRelevance().getFitness() / episodes;
-    least_relevant_fitness.at(epoch).at(generation) += pop.worstIndividual()->getRelevance().getFitness() / episodes;
-}
-
-void Statistics::recordRelevance(Population &pop, unsigned int epoch, unsigned int generation) {
-    best_relevance.at(epoch).at(generation) += pop.bestIndividual()->getRelevance().relevance() / episodes;
-    Individual *average_individual = pop.averageIndividual();
-    average_relevance.at(epoch).at(generation) += average_individual->getRelevance().relevance() / episodes;
-    delete average_individual;
-    worst_relevance.at(epoch).at(generation) += pop.worstIndividual()->getRelevance().relevance() / episodes;
-}
\ No newline at end of file
+bool Statistics::moreRelevant(Population &pop, unsigned int slot, unsigned int other) const {
+    std::vector<Individual *> &individuals = pop.getIndividuals();
+    return individuals.at(slot)->getRelevance() > individuals.at(other)->getRelevance();
+}
+
+bool Statistics::lessRelevant(Population &pop, unsigned int slot, unsigned int other) const {
+    std::vector<Individual *> &individuals = pop.getIndividuals();
+    return individuals.at(slot)->getRelevance() < individuals.at(other)->getRelevance();
+}
@@ -3,12 +3,17 @@
 
 
 #include "../representation/Population.h"
+#include "../util/ThreadPool.h"
 
 /**
  * The core module that records a time series of fitness, cost and relevance data that is obtained during a run of a
  * Neuro-Dynamic Evolutionary Algorithm (NDEA). Accordingly, each (epoch, generation) pair maps on a recorded data point
  * that is averaged over the total number of episodes in each epoch.
  *
+ * All series are computed by a single fused reduction over the population's relevance arrays, which is optionally
+ * split into ranges that are reduced concurrently by the thread pool. The recorded series can be restricted by a bit
+ * mask of the statistics configuration.
+ *
  * @author  Felix Voelker
  * @version 0.1.0
  * @since   25.1.2018
@@ -16,17 +21,51 @@
 class Statistics {
 
 public:
+    /**
+     * The recordable series of the statistics.
+     */
+    enum Series : unsigned int {
+        BEST_COST              = 1u << 0,
+        AVERAGE_COST           = 1u << 1,
+        WORST_COST             = 1u << 2,
+        BEST_FITNESS           = 1u << 3,
+        AVERAGE_FITNESS        = 1u << 4,
+        WORST_FITNESS          = 1u << 5,
+        BEST_RELEVANCE         = 1u << 6,
+        AVERAGE_RELEVANCE      = 1u << 7,
+        WORST_RELEVANCE        = 1u << 8,
+        MOST_RELEVANT_COST     = 1u << 9,
+        LEAST_RELEVANT_COST    = 1u << 10,
+        MOST_RELEVANT_FITNESS  = 1u << 11,
+        LEAST_RELEVANT_FITNESS = 1u << 12,
+        ALL_SERIES             = (1u << 13) - 1
+    };
+
     explicit Statistics(const core::Configuration &configuration);
+    explicit Statistics(const core::Configuration &configuration, ThreadPool &pool);
     ~Statistics();
 
     /**
-     * Records all relevant data for the statistic.
+     * Records all selected series for the statistic.
      * @param pop State of evolutionary system's population.
      * @param epoch Current epoch of the evolutionary run.
      * @param generation Current generation of the evolutionary run.
      */
     void record(Population &pop, unsigned int epoch, unsigned int generation);
 
+    /**
+     * Adds the recorded data of another statistic, e.g. of a concurrent lane of episodes, to this statistic. Since
+     * each data point is already averaged over the total number of episodes, the merged statistic averages over the
+     * episodes of both statistics.
+     * @param other The statistic to be merged.
+     */
+    void merge(const Statistics &other);
+
+    /**
+     * Resets all recorded data.
+     */
+    void clear();
+
     /**
      * Returns the best cost values for each generation.
      * @param epoch Requested epoch of the evolutionary run.
@@ -132,35 +171,47 @@ protected:
     std::vector<std::vector<float>> most_relevant_fitness;
     std::vector<std::vector<float>> least_relevant_fitness;
 
+    /** The bit mask of the recorded series. */
+    unsigned int series;
+    unsigned int threads;
+    ThreadPool *pool = nullptr;
+
     /**
-     * Records the best, average and worst cost values of the population as well as the cost of the individuals with
-     * the highest and lowest relevance values in the population at each generation and averages it by the total number
-     * of episodes in each epoch.
-     * @param pop State of evolutionary system's population.
-     * @param epoch Current epoch of the evolutionary run.
-     * @param generation Current generation of the evolutionary run.
+     * The partial result of reducing a range of slots.
      */
-    void recordCost(Population &pop, unsigned int epoch, unsigned int generation);
+    struct Reduction {
+        float best_cost;
+        float worst_cost;
+        double total_cost = 0;
+        float best_fitness;
+        float worst_fitness;
+        double total_fitness = 0;
+        unsigned int most_relevant = 0;
+        unsigned int least_relevant = 0;
+        float best_relevance;
+        float worst_relevance;
+    };
 
     /**
-     * Records the best, average and worst fitness values of the population as well as the fitness of the individuals
-     * with the highest and lowest relevance values in the population at each generation and averages it by the total
-     * number of episodes in each epoch.
-     * @param pop State of evolutionary system's population.
-     * @param epoch Current epoch of the evolutionary run.
-     * @param generation Current generation of the evolutionary run.
+     * Reduces the relevance arrays of the population in a single pass over the slots [onset, onset + offset). Unless
+     * the individuals use the base Relevance, the most and least relevant slots are determined by the comparison
+     * operators of the relevance, just like Population::bestIndividual and Population::worstIndividual do.
+     * @param pop    State of evolutionary system's population.
+     * @param onset  First slot of the range.
+     * @param offset Number of slots within the range.
      */
-    void recordFitness(Population &pop, unsigned int epoch, unsigned int generation);
+    Reduction reduce(Population &pop, unsigned int onset, unsigned int offset) const;
 
     /**
-     * Records the best, average and worst relevance values of the population as well as the relevance of the
-     * individuals with the highest and lowest relevance values in the population at each generation and averages it by
-     * the total number of episodes in each epoch.
-     * @param pop State of evolutionary system's population.
-     * @param epoch Current epoch of the evolutionary run.
-     * @param generation Current generation of the evolutionary run.
+     * Merges the partial result of a succeeding range into the given reduction.
+     */
+    void merge(Population &pop, Reduction &reduction, const Reduction &partial) const;
+
+    /**
+     * Compares the relevances of the individuals at the given slots by their comparison operators.
      */
-    void recordRelevance(Population &pop, unsigned int epoch, unsigned int generation);
+    bool moreRelevant(Population &pop, unsigned int slot, unsigned int other) const;
+    bool lessRelevant(Population &pop, unsigned int slot, unsigned int other) const;
 
 };
 
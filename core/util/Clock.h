@@ -0,0 +1,22 @@
+#ifndef RATATOSKR_CLOCK_H
+#define RATATOSKR_CLOCK_H
+
+
+/**
+ * Represents the current position of a lane within a run of the evolutionary system. Together with a slot of the
+ * population and a phase, this position identifies the random stream that is used to process the slot. Hence, the
+ * random numbers of an individual do not depend on which thread processes it.
+ *
+ * @author  Felix Voelker
+ * @version 0.1.0
+ * @since   27.1.2018
+ */
+struct Clock {
+    unsigned long long seed = 0;
+    unsigned int epoch = 0;
+    unsigned int episode = 0;
+    unsigned int generation = 0;
+};
+
+
+#endif //RATATOSKR_CLOCK_H
@@ -0,0 +1,71 @@
+#include <algorithm>
+#include <cstdint>
+#include "Matrix.h"
+
+const std::size_t Matrix::ALIGNMENT;
+
+Matrix::Matrix() : rows(0), columns(0), stride(0), capacity(0), storage(nullptr), data(nullptr) {}
+
+Matrix::Matrix(std::size_t rows, std::size_t columns) : Matrix() {
+    resize(rows, columns);
+}
+
+Matrix::Matrix(const Matrix &obj) : Matrix() {
+    *this = obj;
+}
+
+Matrix & Matrix::operator=(const Matrix &obj) {
+    if (this != &obj) {
+        resize(obj.rows, obj.columns);
+        std::copy(obj.data, obj.data + rows * stride, data);
+    }
+    return *this;
+}
+
+Matrix::~Matrix() {
+    delete[] storage;
+}
+
+void Matrix::resize(std::size_t rows, std::size_t columns) {
+    const std::size_t floats = ALIGNMENT / sizeof(float);
+    this->rows = rows;
+    this->columns = columns;
+    this->stride = (columns + floats - 1) / floats * floats;
+    if (rows * stride > capacity)
+        allocate(rows * stride);
+    std::fill(data, data + rows * stride, 0.0f);
+}
+
+void Matrix::fill(float value) {
+    for (std::size_t k = 0; k < rows; k++)
+        std::fill(row(k), row(k) + columns, value);
+}
+
+float * Matrix::row(std::size_t k) {
+    return data + k * stride;
+}
+
+const float * Matrix::row(std::size_t k) const {
+    return data + k * stride;
+}
+
+std::size_t Matrix::getRows() const {
+    return rows;
+}
+
+std::size_t Matrix::getColumns() const {
+    return columns;
+}
+
+std::size_t Matrix::getStride() const {
+    return stride;
+}
+
+void Matrix::allocate(std::size_t size) {
+    // Operator new only guarantees the alignment of fundamental types, thus the storage is over-allocated by a line.
+    delete[] storage;
+    storage = new float[size + ALIGNMENT / sizeof(float)];
+    auto address = reinterpret_cast<std::uintptr_t>(storage);
+    data = reinterpret_cast<float *>((address + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT);
+    capacity = size;
+}
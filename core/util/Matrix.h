@@ -0,0 +1,71 @@
+#ifndef RATATOSKR_MATRIX_H
+#define RATATOSKR_MATRIX_H
+
+
+#include <cstddef>
+
+/**
+ * Represents a dense row-major matrix of floats whose rows start at 64-byte boundaries, i.e. at the boundaries of
+ * cache lines. Each row is padded to a multiple of 16 floats, so that loops over a row run on whole vector registers
+ * and never share a cache line with the next row. The padding is always zero.
+ *
+ * @author  Felix Voelker
+ * @version 0.1.0
+ * @since   27.1.2018
+ */
+class Matrix {
+
+public:
+    /** The alignment of each row in bytes. */
+    static const std::size_t ALIGNMENT = 64;
+
+    Matrix();
+
+    /**
+     * Creates a zero matrix.
+     * @param rows    Number of rows.
+     * @param columns Number of columns.
+     */
+    Matrix(std::size_t rows, std::size_t columns);
+
+    Matrix(const Matrix &obj);
+    Matrix & operator=(const Matrix &obj);
+    ~Matrix();
+
+    /**
+     * Reshapes the matrix and sets all entries to zero. The storage is only reallocated if it has to grow.
+     */
+    void resize(std::size_t rows, std::size_t columns);
+
+    /**
+     * Sets all entries of the matrix to the given value, whereas the padding remains zero.
+     */
+    void fill(float value);
+
+    float * row(std::size_t k);
+    const float * row(std::size_t k) const;
+
+    std::size_t getRows() const;
+    std::size_t getColumns() const;
+
+    /**
+     * Returns the distance between the beginnings of two consecutive rows in floats.
+     */
+    std::size_t getStride() const;
+
+private:
+    std::size_t rows;
+    std::size_t columns;
+    std::size_t stride;
+    std::size_t capacity;
+
+    /** The allocated storage and its first aligned float. */
+    float *storage;
+    float *data;
+
+    void allocate(std::size_t size);
+
+};
+
+
+#endif //RATATOSKR_MATRIX_H
@@ -0,0 +1,62 @@
+#include "Philox.h"
+
+Philox::Philox(std::uint64_t key) {
+    seed(key, 0, 0, 0);
+}
+
+void Philox::seed(std::uint64_t key, std::uint32_t stream0, std::uint32_t stream1, std::uint32_t stream2) {
+    this->key[0] = static_cast<std::uint32_t>(key);
+    this->key[1] = static_cast<std::uint32_t>(key >> 32);
+    counter[0] = 0;
+    counter[1] = stream0;
+    counter[2] = stream1;
+    counter[3] = stream2;
+    index = 4;
+}
+
+Philox::result_type Philox::operator()() {
+    if (index == 4) {
+        generate(block);
+        index = 0;
+    }
+    return block[index++];
+}
+
+void Philox::fill(result_type *words, std::size_t n) {
+    std::size_t k = 0;
+    for (; k < n && index < 4; k++)
+        words[k] = block[index++];
+    for (; k + 4 <= n; k += 4)
+        generate(words + k);
+    for (; k < n; k++)
+        words[k] = operator()();
+}
+
+void Philox::generate(std::uint32_t *output) {
+    std::uint32_t x[4] = { counter[0], counter[1], counter[2], counter[3] };
+    std::uint32_t k0 = key[0];
+    std::uint32_t k1 = key[1];
+    for (unsigned int round = 0; round < 10; round++) {
+        std::uint64_t product0 = static_cast<std::uint64_t>(0xD2511F53) * x[0];
+        std::uint64_t product1 = static_cast<std::uint64_t>(0xCD9E8D57) * x[2];
+        std::uint32_t y[4] = {
+                static_cast<std::uint32_t>(product1 >> 32) ^ x[1] ^ k0,
+                static_cast<std::uint32_t>(product1),
+                static_cast<std::uint32_t>(product0 >> 32) ^ x[3] ^ k1,
+                static_cast<std::uint32_t>(product0)
+        };
+        x[0] = y[0];
+        x[1] = y[1];
+        x[2] = y[2];
+        x[3] = y[3];
+        k0 += 0x9E3779B9;
+        k1 += 0xBB67AE85;
+    }
+    output[0] = x[0];
+    output[1] = x[1];
+    output[2] = x[2];
+    output[3] = x[3];
+
+    // The counter is incremented as a 128-bit integer, although a single stream never exhausts its lowest word.
+    for (unsigned int k = 0; k < 4 && ++counter[k] == 0; k++);
+}
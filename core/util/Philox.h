@@ -0,0 +1,65 @@
+#ifndef RATATOSKR_PHILOX_H
+#define RATATOSKR_PHILOX_H
+
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Represents the counter-based Philox4x32-10 random generator as described in "John K. Salmon et al.: Parallel Random
+ * Numbers: As Easy as 1, 2, 3 (2011)." Each block of four random words is a bijection of a 128-bit counter under a
+ * 64-bit key. Accordingly, a random stream is fully determined by its key and the upper three words of the counter,
+ * so that streams can be assigned to arbitrary units of work without any shared state between threads.
+ *
+ * The generator satisfies the requirements of a uniform random bit generator and can be used with the distributions
+ * of the standard library.
+ *
+ * @author  Felix Voelker
+ * @version 0.1.0
+ * @since   27.1.2018
+ */
+class Philox {
+
+public:
+    typedef std::uint32_t result_type;
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return 0xFFFFFFFF; }
+
+    /**
+     * Creates a generator at the beginning of the stream (0, 0, 0) under the given key.
+     */
+    explicit Philox(std::uint64_t key = 0);
+
+    /**
+     * Moves the generator to the beginning of a stream.
+     * @param key    The key of the stream, e.g. the seed of the run.
+     * @param stream The upper three words of the counter that identify the stream.
+     */
+    void seed(std::uint64_t key, std::uint32_t stream0, std::uint32_t stream1, std::uint32_t stream2);
+
+    /**
+     * Returns the next random word of the stream.
+     */
+    result_type operator()();
+
+    /**
+     * Writes the next n random words of the stream, generating whole blocks at once where possible.
+     */
+    void fill(result_type *words, std::size_t n);
+
+private:
+    std::uint32_t key[2];
+    std::uint32_t counter[4];
+    std::uint32_t block[4];
+    unsigned int index;
+
+    /**
+     * Encrypts the current counter into the next block and increments the counter.
+     */
+    void generate(std::uint32_t *output);
+
+};
+
+
+#endif //RATATOSKR_PHILOX_H
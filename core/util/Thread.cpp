@@ -1,3 +1,6 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include "Thread.h"
 
 Thread::Thread(unsigned int onset, unsigned int offset) {
@@ -13,17 +16,80 @@ unsigned int Thread::getChunkOffset() const {
     return offset;
 }
 
+void Thread::Random::seed(const Clock &clock, unsigned int slot, Phase phase) {
+    // Each pair of epoch and phase gets its own key, while the counter distinguishes the slot, generation and
+    // episode with all of their bits. The pairs are distinct multipliers below 2^34, which the finalizer keeps apart.
+    std::uint64_t pair = static_cast<std::uint64_t>(clock.epoch) << 2 | phase;
+    std::uint64_t key = clock.seed + 0x9E3779B97F4A7C15ull * (pair + 1);
+    key = (key ^ key >> 30) * 0xBF58476D1CE4E5B9ull;
+    key = (key ^ key >> 27) * 0x94D049BB133111EBull;
+    key ^= key >> 31;
+    generator.seed(key, slot, clock.generation, clock.episode);
+}
+
 double Thread::Random::sample() {
-    std::uniform_real_distribution<float> distribution(0.0, 1.0);
-    return distribution(generator);
+    Philox::result_type high = generator();
+    Philox::result_type low = generator();
+    return canonical(high, low);
 }
 
 unsigned int Thread::Random::sampleIntFromUniformDistribution(unsigned int n) {
-    std::uniform_int_distribution<unsigned int> distribution(0, n - 1);
-    return distribution(generator);
+    // Unbiased multiply-and-shift reduction as described in "Daniel Lemire: Fast Random Integer Generation in an
+    // Interval (2019)."
+    std::uint64_t product = static_cast<std::uint64_t>(generator()) * n;
+    auto low = static_cast<std::uint32_t>(product);
+    if (low < n) {
+        std::uint32_t threshold = (0u - n) % n;
+        while (low < threshold) {
+            product = static_cast<std::uint64_t>(generator()) * n;
+            low = static_cast<std::uint32_t>(product);
+        }
+    }
+    return static_cast<unsigned int>(product >> 32);
+}
+
+unsigned int Thread::Random::sampleIntFromGeometricDistribution(double p) {
+    if (p >= 1)
+        return 0;
+    if (p <= 0)
+        return std::numeric_limits<unsigned int>::max();
+    double u = (generator() + 1.0) * (1.0 / 4294967296.0);
+    double failures = std::floor(std::log(u) / std::log1p(-p));
+    if (failures >= std::numeric_limits<unsigned int>::max())
+        return std::numeric_limits<unsigned int>::max();
+    return static_cast<unsigned int>(failures);
+}
+
+std::uint64_t Thread::Random::sampleWord() {
+    return static_cast<std::uint64_t>(generator()) << 32 | generator();
+}
+
+void Thread::Random::fill(std::vector<double> &samples) {
+    Philox::result_type buffer[256];
+    for (std::size_t onset = 0; onset < samples.size(); onset += 128) {
+        std::size_t offset = std::min<std::size_t>(128, samples.size() - onset);
+        generator.fill(buffer, 2 * offset);
+        for (std::size_t k = 0; k < offset; k++)
+            samples[onset + k] = canonical(buffer[2 * k], buffer[2 * k + 1]);
+    }
+}
+
+void Thread::Random::fill(std::vector<std::uint64_t> &words) {
+    Philox::result_type buffer[256];
+    for (std::size_t onset = 0; onset < words.size(); onset += 128) {
+        std::size_t offset = std::min<std::size_t>(128, words.size() - onset);
+        generator.fill(buffer, 2 * offset);
+        for (std::size_t k = 0; k < offset; k++)
+            words[onset + k] = static_cast<std::uint64_t>(buffer[2 * k]) << 32 | buffer[2 * k + 1];
+    }
 }
 
 unsigned int Thread::Random::sampleIntFromDiscreteDistribution(std::vector<float> weights) {
     std::discrete_distribution<unsigned int> distribution(weights.begin(), weights.end());
     return distribution(generator);
-}
\ No newline at end of file
+}
+
+double Thread::Random::canonical(Philox::result_type high, Philox::result_type low) {
+    // The upper 27 bits of the first word and the upper 26 bits of the second word form the 53-bit mantissa.
+    return ((high >> 5) * 67108864.0 + (low >> 6)) * (1.0 / 9007199254740992.0);
+}
@@ -2,14 +2,21 @@
 #define RATATOSKR_THREAD_H
 
 
+#include <cstdint>
 #include <random>
 #include <thread>
+#include "../representation/IndividualPool.h"
+#include "Clock.h"
+#include "Philox.h"
 
 /**
  * Represents a thread that processes a specific chunk of the evolutionary system's population. It maintains all
  * information about its corresponding chunk and provides a random module to sample pseudo-random numbers with a
- * mersenne twister random generator. This random module allows to separate its generator from other chunks of the
- * population and therefore prevents that the generator's progression is distorted by other threads.
+ * counter-based Philox generator. This random module allows to separate its generator from other chunks of the
+ * population and therefore prevents that the generator's progression is distorted by other threads. Moreover, the
+ * random module can be moved to the stream of a specific slot, so that the random numbers of each individual are
+ * reproducible regardless of the number of threads. Likewise, each thread maintains its own pool of recycled
+ * individuals.
  *
  * @author  Felix Voelker
  * @version 0.1.0
@@ -19,10 +26,27 @@ class Thread {
 
 public:
     struct Random {
-        std::mt19937 generator = std::mt19937(std::random_device()());
+        /** The phases of a generation, each of which processes a slot with a separate random stream. */
+        enum Phase {
+            INITIALIZATION,
+            EVALUATION,
+            VARIATION,
+            REPLAY
+        };
+
+        Philox generator = Philox(static_cast<std::uint64_t>(std::random_device()()) << 32 | std::random_device()());
 
         /**
-         * Samples a random number from the interval [0.0, 1.0).
+         * Moves the generator to the random stream of a slot at the current position of the lane.
+         * @param clock The position of the lane.
+         * @param slot  The processed slot of the population.
+         * @param phase The processing phase.
+         */
+        void seed(const Clock &clock, unsigned int slot, Phase phase);
+
+        /**
+         * Samples a random number from the interval [0.0, 1.0) with the full 53-bit resolution of a double, which
+         * takes two words of the generator.
          */
         double sample();
 
@@ -32,16 +56,47 @@ public:
          */
         unsigned int sampleIntFromUniformDistribution(unsigned int n);
 
+        /**
+         * Samples a random integer from the geometric distribution G(p), i.e. the number of failed Bernoulli trials
+         * with a success probability p before the first success.
+         * @param p Success probability of each trial.
+         */
+        unsigned int sampleIntFromGeometricDistribution(double p);
+
+        /**
+         * Samples a random word of 64 independent and uniformly distributed bits.
+         */
+        std::uint64_t sampleWord();
+
+        /**
+         * Fills a vector with random numbers from the interval [0.0, 1.0) at once.
+         */
+        void fill(std::vector<double> &samples);
+
+        /**
+         * Fills a vector with random words of 64 independent and uniformly distributed bits at once.
+         */
+        void fill(std::vector<std::uint64_t> &words);
+
         /**
          * Samples a random integer from the discrete distribution D(0, n-1) with
          * the probability mass function P(i) = w_i / sum(weights).
          * @param weights Set of all weights w_i.
          */
         unsigned int sampleIntFromDiscreteDistribution(std::vector<float> weights);
+
+    private:
+        /**
+         * Combines two random words into a random number from the interval [0.0, 1.0) with 53 bits of resolution.
+         */
+        static double canonical(Philox::result_type high, Philox::result_type low);
     };
 
     Random random;
 
+    /** Recycled individuals whose storage is reused by the thread. */
+    IndividualPool pool;
+
     /**
      * Creates a thread to process a specific chunk of the population.
      * @param onset  Onset of the thread's corresponding chunk.
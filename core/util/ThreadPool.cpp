@@ -0,0 +1,72 @@
+#include <algorithm>
+#include "ThreadPool.h"
+
+namespace {
+    /** The pool whose worker runs on the calling thread, if any. */
+    thread_local const ThreadPool *owner = nullptr;
+}
+
+ThreadPool::ThreadPool(const core::Configuration &configuration) : Singleton(configuration) {
+    unsigned int size = std::max({ configuration.getInitializerConfiguration().threads,
+                                   configuration.getEvaluatorConfiguration().threads,
+                                   configuration.getBreederConfiguration().threads,
+                                   configuration.getReplayerConfiguration().threads,
+                                   configuration.getStatisticsConfiguration().threads,
+                                   configuration.getEvolutionarySystemConfiguration().concurrency,
+                                   1u });
+    for (unsigned int k = 0; k < size; k++) {
+        workers.emplace_back(&ThreadPool::work, this);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        terminated = true;
+    }
+    submitted.notify_all();
+
+    for (auto &worker : workers) {
+        worker.join();
+    }
+}
+
+void ThreadPool::execute(std::vector<std::function<void()>> &tasks) {
+    if (owner == this) {
+        for (auto &task : tasks)
+            task();
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(mutex);
+    for (auto &task : tasks) {
+        this->tasks.push(&task);
+    }
+    pending += tasks.size();
+    submitted.notify_all();
+
+    finished.wait(lock, [this] { return pending == 0; });
+}
+
+unsigned int ThreadPool::getSize() const {
+    return static_cast<unsigned int>(workers.size());
+}
+
+void ThreadPool::work() {
+    owner = this;
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        submitted.wait(lock, [this] { return terminated || !tasks.empty(); });
+        if (tasks.empty())
+            return;
+
+        std::function<void()> *task = tasks.front();
+        tasks.pop();
+        lock.unlock();
+        (*task)();
+        lock.lock();
+
+        if (--pending == 0)
+            finished.notify_all();
+    }
+}
@@ -0,0 +1,62 @@
+#ifndef RATATOSKR_THREADPOOL_H
+#define RATATOSKR_THREADPOOL_H
+
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+#include "Singleton.h"
+
+/**
+ * Represents the set of long-lived worker threads that drive all concurrent phases of the evolutionary system. Rather
+ * than spawning and joining new threads for each phase of each generation, the initializer, evaluator and breeder
+ * submit the processing of their chunks as tasks to the pool and wait for their completion. The pool is sized by the
+ * highest number of threads requested by any of these phases, the statistics and the concurrent episodes.
+ *
+ * @author  Felix Voelker
+ * @version 0.1.0
+ * @since   27.1.2018
+ */
+class ThreadPool : public Singleton {
+
+public:
+    explicit ThreadPool(const core::Configuration &configuration);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool &obj) = delete;
+    ThreadPool & operator=(const ThreadPool &obj) = delete;
+
+    /**
+     * Executes a batch of tasks concurrently on the worker threads and blocks until each of them has finished. If it is
+     * called by a task of this pool, e.g. by a concurrent episode, the tasks are executed sequentially on the calling
+     * worker instead, thus nested batches cannot exhaust the workers.
+     * @param tasks The tasks to be executed.
+     */
+    void execute(std::vector<std::function<void()>> &tasks);
+
+    unsigned int getSize() const;
+
+private:
+    bool terminated = false;
+    unsigned int pending = 0;
+
+    std::vector<std::thread> workers;
+    std::queue<std::function<void()> *> tasks;
+
+    std::mutex mutex;
+    std::condition_variable submitted;
+    std::condition_variable finished;
+
+    /**
+     * Runs the loop of a worker thread, i.e. it waits for submitted tasks and executes them until the pool is
+     * destroyed.
+     */
+    void work();
+
+};
+
+
+#endif //RATATOSKR_THREADPOOL_H
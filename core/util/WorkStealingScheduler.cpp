@@ -0,0 +1,76 @@
+#include "WorkStealingScheduler.h"
+
+WorkStealingScheduler::WorkStealingScheduler(unsigned int workers, bool stealing) {
+    this->workers = workers;
+    this->stealing = stealing;
+    ranges = new std::atomic<unsigned long long>[workers];
+    for (unsigned int k = 0; k < workers; k++) {
+        ranges[k].store(0);
+    }
+}
+
+WorkStealingScheduler::~WorkStealingScheduler() {
+    delete[] ranges;
+}
+
+void WorkStealingScheduler::distribute(unsigned int size, unsigned int grainsize) {
+    this->size = size;
+    this->grainsize = grainsize > 0 ? grainsize : 1;
+
+    unsigned long long grains = (size + this->grainsize - 1) / this->grainsize;
+    for (unsigned int k = 0; k < workers; k++) {
+        unsigned long long front = grains * k / workers;
+        unsigned long long back = grains * (k + 1) / workers;
+        ranges[k].store(front << 32 | back);
+    }
+}
+
+bool WorkStealingScheduler::fetch(unsigned int worker, unsigned int &onset, unsigned int &offset) {
+    unsigned int grain;
+    bool fetched = take(worker, grain);
+    for (unsigned int k = 1; stealing && !fetched && k < workers; k++) {
+        fetched = steal((worker + k) % workers, grain);
+    }
+
+    if (fetched) {
+        onset = grain * grainsize;
+        offset = onset + grainsize > size ? size - onset : grainsize;
+    }
+    return fetched;
+}
+
+unsigned int WorkStealingScheduler::getWorkers() const {
+    return workers;
+}
+
+bool WorkStealingScheduler::take(unsigned int worker, unsigned int &grain) {
+    unsigned long long range = ranges[worker].load();
+    while (true) {
+        auto front = static_cast<unsigned int>(range >> 32);
+        auto back = static_cast<unsigned int>(range);
+        if (front >= back)
+            return false;
+
+        unsigned long long next = static_cast<unsigned long long>(front + 1) << 32 | back;
+        if (ranges[worker].compare_exchange_weak(range, next)) {
+            grain = front;
+            return true;
+        }
+    }
+}
+
+bool WorkStealingScheduler::steal(unsigned int worker, unsigned int &grain) {
+    unsigned long long range = ranges[worker].load();
+    while (true) {
+        auto front = static_cast<unsigned int>(range >> 32);
+        auto back = static_cast<unsigned int>(range);
+        if (front >= back)
+            return false;
+
+        unsigned long long next = static_cast<unsigned long long>(front) << 32 | (back - 1);
+        if (ranges[worker].compare_exchange_weak(range, next)) {
+            grain = back - 1;
+            return true;
+        }
+    }
+}
@@ -0,0 +1,75 @@
+#ifndef RATATOSKR_WORKSTEALINGSCHEDULER_H
+#define RATATOSKR_WORKSTEALINGSCHEDULER_H
+
+
+#include <atomic>
+
+/**
+ * Represents a scheduler that distributes the slots of the population as small grains among a number of workers.
+ * Initially, each worker owns a contiguous range of grains that it processes from the front. As soon as its own range
+ * is exhausted, the worker steals the grains from the back of the other workers' ranges. Accordingly, a single
+ * expensive grain only stalls its own worker while the remaining grains are processed by idle workers.
+ *
+ * Each range is packed into a single atomic word so that taking and stealing grains does not require any locks.
+ *
+ * @author  Felix Voelker
+ * @version 0.1.0
+ * @since   27.1.2018
+ */
+class WorkStealingScheduler {
+
+public:
+    /**
+     * Creates a scheduler for a number of workers.
+     * @param workers  Number of workers that take part in the processing.
+     * @param stealing Determines whether idle workers steal grains from busy ones.
+     */
+    explicit WorkStealingScheduler(unsigned int workers, bool stealing);
+    ~WorkStealingScheduler();
+
+    WorkStealingScheduler(const WorkStealingScheduler &obj) = delete;
+    WorkStealingScheduler & operator=(const WorkStealingScheduler &obj) = delete;
+
+    /**
+     * Splits the slots [0, size) into grains and assigns an uniformly divided range of these grains to each worker.
+     * This method must not be called while any worker fetches grains.
+     * @param size      Number of slots to be processed.
+     * @param grainsize Maximum number of slots in each grain.
+     */
+    void distribute(unsigned int size, unsigned int grainsize);
+
+    /**
+     * Fetches the next grain for a worker, i.e. the front grain of its own range or, if its range is exhausted,
+     * a grain from the back of another worker's range.
+     * @param worker The fetching worker.
+     * @param onset  Onset of the fetched grain.
+     * @param offset Number of slots within the fetched grain.
+     * @return False if no grains are left, true otherwise.
+     */
+    bool fetch(unsigned int worker, unsigned int &onset, unsigned int &offset);
+
+    unsigned int getWorkers() const;
+
+private:
+    bool stealing;
+    unsigned int workers;
+    unsigned int size = 0;
+    unsigned int grainsize = 1;
+
+    /** The [front, back) range of grains owned by each worker, packed as (front << 32) | back. */
+    std::atomic<unsigned long long> *ranges;
+
+    /**
+     * Takes the front grain of the given worker's range.
+     */
+    bool take(unsigned int worker, unsigned int &grain);
+
+    /**
+     * Steals the back grain of the given worker's range.
+     */
+    bool steal(unsigned int worker, unsigned int &grain);
+
+};
+
+
+#endif //RATATOSKR_WORKSTEALINGSCHEDULER_H
@@ -1,8 +1,13 @@
 #include "Breeder.h"
 
-Breeder::Breeder(const core::Configuration &configuration, BreedingOperator &variation_tree)
+Breeder::Breeder(const core::Configuration &configuration,
+                 BreedingOperator &variation_tree,
+                 ThreadPool &pool,
+                 const Clock *clock)
         : Singleton(configuration),
-          varythreads(std::vector<Thread *>(configuration.getBreederConfiguration().threads))
+          varythreads(std::vector<Thread *>(configuration.getBreederConfiguration().threads)),
+          pool(pool),
+          clock(clock)
 {
     this->variation_tree = variation_tree.clone();
     unsigned int onset  = 0;
@@ -12,6 +17,9 @@ Breeder::Breeder(const core::Configuration &configuration, BreedingOperator &var
         onset += offset;
     }
     varythreads.at(varythreads.size() - 1) = new Thread(onset, configuration.getProblemConfiguration().popsize - onset);
+
+    for (unsigned int k = 0; k < varythreads.size(); k++)
+        plans.push_back(new VariationPlan(*this->variation_tree));
 }
 
 Breeder::~Breeder() {
@@ -19,45 +27,60 @@ Breeder::~Breeder() {
         delete thread;
     std::vector<Thread *>().swap(varythreads);
 
+    for (auto *plan : plans)
+        delete plan;
+    std::vector<VariationPlan *>().swap(plans);
+
     delete variation_tree;
 }
 
-std::vector<Individual *> * Breeder::breedPopulation(Population &pop) const {
-    auto &parents = pop.getIndividuals();
-    auto offsprings = new std::vector<Individual *>(parents.size());
+void Breeder::breedPopulation(Population &pop) const {
+    variation_tree->prepare(pop);
 
-    std::vector<std::thread> threads(varythreads.size());
+    std::vector<std::function<void()>> tasks(varythreads.size());
     for (unsigned int k = 0; k < varythreads.size(); k++) {
-        threads.at(k) = std::thread(&Breeder::breedChunk, this, std::ref(parents), std::ref(*offsprings), std::ref(*varythreads.at(k)));
+        Thread &thread = *varythreads.at(k);
+        VariationPlan &plan = *plans.at(k);
+        tasks.at(k) = [this, &pop, &thread, &plan] { breedChunk(pop, thread, plan); };
     }
+    pool.execute(tasks);
 
-    for (auto &thread : threads) {
-        thread.join();
-    }
+    variation_tree->finish(pop);
+}
 
-    return offsprings;
+void Breeder::recyclePopulation(Population &pop) const {
+    auto &parents = pop.getIndividuals();
+    for (auto *thread : varythreads) {
+        for (unsigned int k = thread->getChunkOnset(); k < thread->getChunkOnset() + thread->getChunkOffset(); k++) {
+            Individual *parent = parents.at(k);
+            pop.setIndividual(k, nullptr);
+            thread->pool.release(parent);
+        }
+    }
 }
 
-void Breeder::breedChunk(std::vector<Individual *> &parents,
-                         std::vector<Individual *> &offsprings,
-                         Thread &thread) const {
+void Breeder::breedChunk(Population &pop, Thread &thread, VariationPlan &plan) const {
+    auto &parents = pop.getIndividuals();
     unsigned int survivors = 0;
     for (unsigned int k = 0; k < thread.getChunkOffset(); k += survivors) {
-        std::vector<Individual *> offspring = variation_tree->vary(parents, thread);
-        if (thread.getChunkOnset() + thread.getChunkOffset() < thread.getChunkOnset() + k + offspring.size()) {
-            survivors = thread.getChunkOffset() - k;
+        if (clock != nullptr)
+            thread.random.seed(*clock, thread.getChunkOnset() + k, Thread::Random::VARIATION);
+        unsigned int needed = thread.getChunkOffset() - k;
+        std::vector<Individual *> &offspring = plan.execute(parents, thread, needed);
+        if (needed < offspring.size()) {
+            survivors = needed;
             for (unsigned int l = 0; l < survivors; l++) {
                 unsigned int index = thread.random.sampleIntFromUniformDistribution(static_cast<unsigned int>(offspring.size()));
-                offsprings.at(thread.getChunkOnset() + k + l) = offspring.at(index);
+                pop.setOffspring(thread.getChunkOnset() + k + l, offspring.at(index));
                 offspring.erase(offspring.begin() + index);
             }
             for (auto o : offspring) {
-                delete o;
+                thread.pool.release(o);
             }
         } else {
             survivors = static_cast<unsigned int>(offspring.size());
             for (unsigned int l = 0; l < survivors; l++) {
-                offsprings.at(thread.getChunkOnset() + k + l) = offspring.at(l);
+                pop.setOffspring(thread.getChunkOnset() + k + l, offspring.at(l));
             }
         }
     }
@@ -3,11 +3,16 @@
 
 
 #include "BreedingOperator.h"
+#include "VariationPlan.h"
+#include "../util/ThreadPool.h"
 
 /**
  * The core module that drives the variation phase of an Neuro-Dynamic Evolutionary Algorithm (NDEA). This variation is
  * performed on the entire population that is split into several uniformly divided chunks. These chunks are concurrently
- * processed by the variation threads whose number equals the amount of chunks.
+ * processed by the thread pool of the evolutionary system, while each chunk maintains its own random module across
+ * generations. If a clock is given, the variation tree is applied with the random stream of the first slot that it
+ * fills instead. The variation tree is compiled once into a flat plan per thread, so that breeding a chunk does not
+ * recurse through the tree or allocate intermediate lists of offspring.
  *
  * @author  Felix Voelker
  * @version 0.1.0
@@ -16,32 +21,44 @@
 class Breeder : public Singleton {
 
 public:
-    explicit Breeder(const core::Configuration &configuration, BreedingOperator &variation_tree);
+    explicit Breeder(const core::Configuration &configuration,
+                     BreedingOperator &variation_tree,
+                     ThreadPool &pool,
+                     const Clock *clock = nullptr);
     ~Breeder();
 
     /**
-     * Breeds an entire new generation of offsprings concurrently.
+     * Breeds an entire new generation of offsprings concurrently into the offspring slots of the population.
      * @param pop State of evolutionary system's population.
      */
-    std::vector<Individual *> * breedPopulation(Population &pop) const;
+    void breedPopulation(Population &pop) const;
+
+    /**
+     * Releases the parents of each chunk into the individual pool of the chunk's thread, thus their storage is
+     * reused by the offsprings of the next generation. Afterwards, the population is empty.
+     * @param pop State of evolutionary system's population.
+     */
+    void recyclePopulation(Population &pop) const;
 
 protected:
     std::vector<Thread *> varythreads;
+    ThreadPool &pool;
+    const Clock *clock;
 
     /** Components */
     BreedingOperator *variation_tree;
+    std::vector<VariationPlan *> plans;
 
     /**
-     * Breeds the offspring for a given chunk of the population only. This function is called by each of the
-     * variating threads and passes the chunk to the variation tree. If the tree produces too much offsprings to fit
-     * into the chunk, the remaining slots are assigned randomly.
-     * @param parents    The parent individuals of the current generation.
-     * @param offsprings The offspring individuals of the next generation.
-     * @param thread     The variating thread.
+     * Breeds the offspring for a given chunk of the population only. This function is submitted to the thread pool
+     * for each chunk and asks the variation tree for the number of offsprings that still fit into the chunk. Only if
+     * an operator of the tree breeds more offsprings than needed, the remaining slots are assigned randomly and the
+     * surplus is released into the thread's pool.
+     * @param pop    State of evolutionary system's population.
+     * @param thread The variating thread.
+     * @param plan   The compiled variation tree of the thread.
      */
-    void breedChunk(std::vector<Individual *> &parents,
-                    std::vector<Individual *> &offsprings,
-                    Thread &thread) const;
+    void breedChunk(Population &pop, Thread &thread, VariationPlan &plan) const;
 };
 
 
@@ -15,6 +15,16 @@ void BreedingOperator::setup(std::vector<VariationSource *> *sources) {
     }
 }
 
+unsigned long BreedingOperator::demand(unsigned long needed) const {
+    return ALL;
+}
+
+std::vector<Individual *> & BreedingOperator::breedExactly(std::vector<Individual *> &parents,
+                                                           unsigned long needed,
+                                                           Thread &thread) const {
+    return breed(parents, thread);
+}
+
 std::vector<Individual *> BreedingOperator::perform(std::vector<Individual *> &parents, Thread &thread) const {
     return breed(parents, thread);
 }
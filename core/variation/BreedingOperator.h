@@ -16,6 +16,8 @@
  */
 class BreedingOperator : public VariationSource {
 
+    friend class VariationPlan;
+
 public:
     explicit BreedingOperator(const core::Configuration &configuration);
 
@@ -33,6 +35,26 @@ protected:
      */
     virtual std::vector<Individual *> & breed(std::vector<Individual *> &parents, Thread &thread) const = 0;
 
+    /**
+     * Specifies how many of the leading parents the operator modifies to breed the given number of offsprings. The
+     * remaining parents are only read, thus a selection in their place may lend an individual of the population
+     * instead of acquiring a copy of it. By default, the operator may modify all of its parents.
+     * @param needed The number of offsprings to breed or ALL.
+     */
+    virtual unsigned long demand(unsigned long needed) const;
+
+    /**
+     * Breeds at most the given number of offsprings from the given parent individuals, while the parents beyond the
+     * operator's demand must neither be modified nor returned. Parents that are not returned are released by the
+     * caller. By default, the operator breeds as many offsprings as its strategy yields.
+     * @param parents A list of parent individuals.
+     * @param needed  The number of offsprings to breed or ALL.
+     * @param thread  The variating thread.
+     */
+    virtual std::vector<Individual *> & breedExactly(std::vector<Individual *> &parents,
+                                                     unsigned long needed,
+                                                     Thread &thread) const;
+
     std::vector<Individual *> perform(std::vector<Individual *> &parents, Thread &thread) const override;
 
 };
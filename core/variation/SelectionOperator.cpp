@@ -8,6 +8,6 @@ unsigned long SelectionOperator::expectedSources() const {
 
 std::vector<Individual *> SelectionOperator::perform(std::vector<Individual *> &parents, Thread &thread) const {
     auto selected = std::vector<Individual *>(1);
-    selected.at(0) = select(parents, thread)->clone();
+    selected.at(0) = thread.pool.acquire(*select(parents, thread));
     return selected;
 }
\ No newline at end of file
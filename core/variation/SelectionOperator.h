@@ -15,6 +15,8 @@
  */
 class SelectionOperator : public VariationSource {
 
+    friend class VariationPlan;
+
 public:
     explicit SelectionOperator(const core::Configuration &configuration);
 
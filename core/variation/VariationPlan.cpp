@@ -0,0 +1,133 @@
+#include <algorithm>
+#include <iostream>
+#include "VariationPlan.h"
+
+VariationPlan::VariationPlan(const VariationSource &root) {
+    compile(root, VariationSource::ALL);
+    buffer.reserve(2 * steps.size());
+    owned.reserve(2 * steps.size());
+    onsets.resize(steps.size());
+    needs.resize(steps.size());
+    demands.resize(steps.size());
+}
+
+std::vector<Individual *> & VariationPlan::execute(std::vector<Individual *> &parents,
+                                                   Thread &thread,
+                                                   unsigned long needed) {
+    buffer.clear();
+    owned.clear();
+    for (unsigned long k = 0; k < steps.size(); k++) {
+        Step &step = steps.at(k);
+        for (auto index : step.entered)
+            enter(index, needed);
+
+        // Just like varying the tree recursively, a source performs on the parents if its children bred nothing.
+        unsigned long onset = onsets.at(k);
+        bool bred = onset < buffer.size();
+        switch (step.kind) {
+            case SELECTION: {
+                auto *selection = static_cast<const SelectionOperator *>(step.source);
+                Individual *selected = selection->select(parents, thread);
+                bool lent = needs.at(k) == 0;
+                buffer.push_back(lent ? selected : thread.pool.acquire(*selected));
+                owned.push_back(!lent);
+                break;
+            }
+            case BREEDING: {
+                auto *breeding = static_cast<const BreedingOperator *>(step.source);
+                if (bred)
+                    step.scratch.assign(buffer.begin() + onset, buffer.end());
+                else
+                    step.scratch.assign(parents.begin(), parents.end());
+                pass(onset, bred, breeding->breedExactly(step.scratch, needs.at(k), thread), thread);
+                break;
+            }
+            default: {
+                if (bred)
+                    step.scratch.assign(buffer.begin() + onset, buffer.end());
+                std::vector<Individual *> offspring = step.source->perform(bred ? step.scratch : parents, thread);
+                pass(onset, bred, offspring, thread);
+            }
+        }
+    }
+
+    return buffer;
+}
+
+unsigned long VariationPlan::getSteps() const {
+    return steps.size();
+}
+
+unsigned long VariationPlan::compile(const VariationSource &source, unsigned long parent) {
+    try {
+        if (!source.initialized)
+            throw VariationSource::InitializationException("Variation Source has not been set up.");
+    } catch (VariationSource::InitializationException &e) {
+        std::cout << e.what() << std::endl;
+        exit(1);
+    }
+
+    unsigned long first = steps.size();
+    std::vector<unsigned long> children;
+    for (auto *child : *source.sources)
+        children.push_back(compile(*child, VariationSource::ALL));
+
+    Step step;
+    step.source = &source;
+    step.parent = parent;
+    if (dynamic_cast<const SelectionOperator *>(&source) != nullptr)
+        step.kind = SELECTION;
+    else if (dynamic_cast<const BreedingOperator *>(&source) != nullptr)
+        step.kind = BREEDING;
+    else
+        step.kind = GENERIC;
+    step.scratch.reserve(2 * children.size());
+    steps.push_back(step);
+
+    // A subtree is entered at its first step in post-order, whereas enclosing subtrees have to be entered before.
+    unsigned long index = steps.size() - 1;
+    for (auto child : children)
+        steps.at(child).parent = index;
+    steps.at(first).entered.insert(steps.at(first).entered.begin(), index);
+    return index;
+}
+
+void VariationPlan::enter(unsigned long index, unsigned long needed) {
+    Step &step = steps.at(index);
+    onsets.at(index) = buffer.size();
+    if (step.parent != VariationSource::ALL) {
+        unsigned long demand = demands.at(step.parent);
+        unsigned long offset = buffer.size() - onsets.at(step.parent);
+        if (demand == VariationSource::ALL)
+            needed = VariationSource::ALL;
+        else if (offset < demand)
+            needed = demand - offset;
+        else
+            needed = step.kind == SELECTION ? 0 : VariationSource::ALL;
+    }
+
+    needs.at(index) = needed;
+    if (step.kind == BREEDING)
+        demands.at(index) = static_cast<const BreedingOperator *>(step.source)->demand(needed);
+    else
+        demands.at(index) = VariationSource::ALL;
+}
+
+void VariationPlan::pass(unsigned long onset, bool bred, std::vector<Individual *> &offspring, Thread &thread) {
+    unsigned long inputs = buffer.size();
+    for (unsigned long k = onset; k < inputs; k++) {
+        if (owned.at(k) && std::find(offspring.begin(), offspring.end(), buffer.at(k)) == offspring.end())
+            thread.pool.release(buffer.at(k));
+    }
+
+    // Offsprings that are not bred from the buffer might be members of the population, thus they are never released.
+    for (auto *o : offspring) {
+        bool lent = !bred;
+        for (unsigned long k = onset; k < inputs && !lent; k++)
+            lent = !owned.at(k) && buffer.at(k) == o;
+        buffer.push_back(o);
+        owned.push_back(!lent);
+    }
+    buffer.erase(buffer.begin() + onset, buffer.begin() + inputs);
+    owned.erase(owned.begin() + onset, owned.begin() + inputs);
+}
@@ -0,0 +1,86 @@
+#ifndef RATATOSKR_VARIATIONPLAN_H
+#define RATATOSKR_VARIATIONPLAN_H
+
+
+#include "SelectionOperator.h"
+#include "BreedingOperator.h"
+
+/**
+ * Represents a variation tree that has been compiled into a flat execution plan. The nodes of the tree are visited once
+ * in post-order, thus each step of the plan consumes the offspring of its children from the top of a shared buffer
+ * and replaces them by its own offspring. Selection and breeding operators are called directly instead of through
+ * the recursive variation of their sources, while all other variation sources fall back to their generic operation.
+ * Since the buffers keep their capacity between calls, executing the plan does not allocate once it has warmed up.
+ *
+ * The number of needed offsprings is passed down the tree before a subtree is executed. Each breeding operator
+ * converts it into the number of parents that it modifies, and selections in place of the other parents lend the
+ * selected individual instead of acquiring a copy. Copies that are bred but not passed on are released by the plan.
+ *
+ * A plan refers to the nodes of the compiled tree and holds mutable scratch buffers, hence each thread needs its own
+ * plan and the tree has to outlive it.
+ *
+ * @author  Felix Voelker
+ * @version 0.1.0
+ * @since   27.1.2018
+ */
+class VariationPlan {
+
+public:
+    /**
+     * Compiles the given variation tree into a plan.
+     * @param  root The root of the variation tree.
+     * @throws InitializationException if any source of the tree has not been set up.
+     */
+    explicit VariationPlan(const VariationSource &root);
+
+    VariationPlan(const VariationPlan &obj) = delete;
+    VariationPlan & operator=(const VariationPlan &obj) = delete;
+
+    /**
+     * Creates offspring individuals just like varying the parents by the root of the compiled tree. Only if an
+     * operator of the tree ignores the number of needed offsprings, the plan may yield more than that.
+     * @param  parents A list of parent individuals.
+     * @param  thread  The variating thread.
+     * @param  needed  The number of offsprings to breed.
+     * @return The offspring, which remains valid until the plan is executed again.
+     */
+    std::vector<Individual *> & execute(std::vector<Individual *> &parents,
+                                        Thread &thread,
+                                        unsigned long needed = VariationSource::ALL);
+
+    unsigned long getSteps() const;
+
+private:
+    enum Kind { SELECTION, BREEDING, GENERIC };
+
+    struct Step {
+        const VariationSource *source;
+        Kind kind;
+        unsigned long parent;
+        std::vector<unsigned long> entered;
+        std::vector<Individual *> scratch;
+    };
+
+    std::vector<Step> steps;
+    std::vector<Individual *> buffer;
+    std::vector<bool> owned;
+    std::vector<unsigned long> onsets;
+    std::vector<unsigned long> needs;
+    std::vector<unsigned long> demands;
+
+    unsigned long compile(const VariationSource &source, unsigned long parent);
+
+    /**
+     * Starts the subtree of a step by recording its onset in the buffer and the number of offsprings it needs.
+     */
+    void enter(unsigned long index, unsigned long needed);
+
+    /**
+     * Replaces the inputs of a step by its offspring and releases the copies among the inputs that are not passed on.
+     */
+    void pass(unsigned long onset, bool bred, std::vector<Individual *> &offspring, Thread &thread);
+
+};
+
+
+#endif //RATATOSKR_VARIATIONPLAN_H
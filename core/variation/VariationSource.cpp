@@ -1,6 +1,9 @@
 #include <iostream>
+#include <limits>
 #include "VariationSource.h"
 
+const unsigned long VariationSource::ALL = std::numeric_limits<unsigned long>::max();
+
 VariationSource::VariationSource(const core::Configuration &configuration) : Prototype(configuration) {}
 
 VariationSource::~VariationSource() {
@@ -29,6 +32,20 @@ void VariationSource::setup(std::vector<VariationSource *> *sources) {
     }
 }
 
+void VariationSource::prepare(Population &pop) {
+    if (initialized) {
+        for (auto *source : *sources)
+            source->prepare(pop);
+    }
+}
+
+void VariationSource::finish(Population &pop) {
+    if (initialized) {
+        for (auto *source : *sources)
+            source->finish(pop);
+    }
+}
+
 std::vector<Individual *> VariationSource::vary(std::vector<Individual *> &parents, Thread &thread) const {
     try {
         if (!initialized)
@@ -20,7 +20,14 @@
  */
 class VariationSource : public Prototype {
 
+    friend class VariationPlan;
+
 public:
+    /**
+     * Denotes an unbounded number of offsprings, i.e. a source breeds as many offsprings as its operation yields.
+     */
+    static const unsigned long ALL;
+
     explicit VariationSource(const core::Configuration &configuration);
     ~VariationSource();
 
@@ -32,6 +39,22 @@ public:
      */
     virtual void setup(std::vector<VariationSource *> *sources);
 
+    /**
+     * Prepares the variation source and its children for breeding the offspring of the given population, e.g. to
+     * precompute data that is shared by all selections of a generation. This method is called once per generation
+     * before any thread varies the parents, thus the prepared data is only read while breeding.
+     * @param pop State of evolutionary system's population.
+     */
+    virtual void prepare(Population &pop);
+
+    /**
+     * Finishes breeding the offspring of the given population, i.e. the variation source and its children discard the
+     * data that has been prepared for it. This method is called once per generation after all threads have varied the
+     * parents, thus no prepared data outlives the population state it was computed from.
+     * @param pop State of evolutionary system's population.
+     */
+    virtual void finish(Population &pop);
+
     /**
      * Creates offspring individuals by varying the given parent individuals recursively, i.e. the variation source's
      * genetic operation is performed on the offspring of the child sources.
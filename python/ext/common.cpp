@@ -1,8 +1,12 @@
 #include <boost/python.hpp>
+#include "../../cc/common/BitVectorIndividual.h"
 #include "../../cc/common/Configuration.h"
 #include "../../cc/common/FeatureVector.h"
 #include "../../cc/common/FitnessProportionateSelection.h"
+#include "../../cc/common/LinearApproximator.h"
+#include "../../cc/common/MultilayerPerceptron.h"
 #include "../../cc/common/Problem.h"
+#include "../../cc/common/TransitionTable.h"
 #include "../../cc/common/VectorIndividual.h"
 
 using namespace boost::python;
@@ -22,10 +26,33 @@ BOOST_PYTHON_MODULE(common) {
 
     common::Configuration::CrossoverConfiguration& (common::Configuration::*crossover)() = &common::Configuration::getCrossoverConfiguration;
     common::Configuration::MutationConfiguration& (common::Configuration::*mutation)() = &common::Configuration::getMutationConfiguration;
+    common::Configuration::TransitionTableConfiguration& (common::Configuration::*transitiontable)() = &common::Configuration::getTransitionTableConfiguration;
+    common::Configuration::MultilayerPerceptronConfiguration& (common::Configuration::*multilayerperceptron)() = &common::Configuration::getMultilayerPerceptronConfiguration;
+    common::Configuration::LinearApproximatorConfiguration& (common::Configuration::*linearapproximator)() = &common::Configuration::getLinearApproximatorConfiguration;
+
+    class_<common::Configuration::CrossoverConfiguration>("CrossoverConfiguration", init<>())
+            .def_readwrite("xover_rate", &common::Configuration::CrossoverConfiguration::xover_rate);
+
+    class_<common::Configuration::MutationConfiguration>("MutationConfiguration", init<>())
+            .def_readwrite("mutation_rate", &common::Configuration::MutationConfiguration::mutation_rate)
+            .def_readwrite("geometric", &common::Configuration::MutationConfiguration::geometric);
+
+    class_<common::Configuration::TransitionTableConfiguration>("TransitionTableConfiguration", init<>())
+            .def_readwrite("capacity", &common::Configuration::TransitionTableConfiguration::capacity);
+
+    class_<common::Configuration::MultilayerPerceptronConfiguration>("MultilayerPerceptronConfiguration", init<>())
+            .def_readwrite("hidden", &common::Configuration::MultilayerPerceptronConfiguration::hidden);
+
+    class_<common::Configuration::LinearApproximatorConfiguration>("LinearApproximatorConfiguration", init<>())
+            .def_readwrite("bits", &common::Configuration::LinearApproximatorConfiguration::bits)
+            .def_readwrite("ngram", &common::Configuration::LinearApproximatorConfiguration::ngram);
 
     class_<common::Configuration, bases<core::Configuration>>("Configuration", init<const common::Configuration::ProblemConfiguration &>())
             .add_property("crossover", make_function(crossover, return_internal_reference<>()))
-            .add_property("mutation", make_function(mutation, return_internal_reference<>()));
+            .add_property("mutation", make_function(mutation, return_internal_reference<>()))
+            .add_property("transitiontable", make_function(transitiontable, return_internal_reference<>()))
+            .add_property("multilayerperceptron", make_function(multilayerperceptron, return_internal_reference<>()))
+            .add_property("linearapproximator", make_function(linearapproximator, return_internal_reference<>()));
 
     class_<FeatureVector, bases<FeatureMap>, boost::noncopyable>("FeatureVector", init<const common::Configuration &>())
             .def("__copy__", &FeatureVector::clone, return_value_policy<manage_new_object>())
@@ -36,6 +63,23 @@ BOOST_PYTHON_MODULE(common) {
             .def("__copy__", &VectorIndividual::clone, return_value_policy<manage_new_object>())
             .def("tostring", &VectorIndividual::toString);
 
+    class_<BitVectorIndividual, bases<Individual>, boost::noncopyable>("BitVectorIndividual", init<const common::Configuration &, FeatureVector &, Relevance &>())
+            .add_property("genes", &BitVectorIndividual::getGenes)
+            .def("__copy__", &BitVectorIndividual::clone, return_value_policy<manage_new_object>())
+            .def("get", &BitVectorIndividual::getGene)
+            .def("set", &BitVectorIndividual::setGene)
+            .def("flip", &BitVectorIndividual::flipGene)
+            .def("tostring", &BitVectorIndividual::toString);
+
+    class_<TransitionTable, bases<EvolutionaryNetwork>, boost::noncopyable>("TransitionTable", init<const common::Configuration &>())
+            .def("__copy__", &TransitionTable::clone, return_value_policy<manage_new_object>());
+
+    class_<MultilayerPerceptron, bases<EvolutionaryNetwork>, boost::noncopyable>("MultilayerPerceptron", init<const common::Configuration &>())
+            .def("__copy__", &MultilayerPerceptron::clone, return_value_policy<manage_new_object>());
+
+    class_<LinearApproximator, bases<EvolutionaryNetwork>, boost::noncopyable>("LinearApproximator", init<const common::Configuration &>())
+            .def("__copy__", &LinearApproximator::clone, return_value_policy<manage_new_object>());
+
     class_<FitnessProportionateSelection, bases<SelectionOperator>, boost::noncopyable>("FitnessProportionateSelection", init<const common::Configuration &>())
             .def("__copy__", &FitnessProportionateSelection::clone, return_value_policy<manage_new_object>());
 }
\ No newline at end of file
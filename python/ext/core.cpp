@@ -67,12 +67,12 @@ BOOST_PYTHON_MODULE(core) {
             .def("getFeaturemap", &IndividualWrapper::getFeaturemap, return_internal_reference<>())
             .def("getRelevance", &IndividualWrapper::getRelevance, return_internal_reference<>());
 
-    class_<Population>("Population", init<const Configuration &>())
+    class_<Population, boost::noncopyable>("Population", init<const Configuration &>())
             .def("bestIndividual", &Population::bestIndividual, return_internal_reference<>())
             .def("averageIndividual", &Population::averageIndividual, return_internal_reference<>())
             .def("worstIndividual", &Population::worstIndividual, return_internal_reference<>());
 
-    class_<Thread>("Thread", init<unsigned int, unsigned int>())
+    class_<Thread, boost::noncopyable>("Thread", init<unsigned int, unsigned int>())
             .def_readonly("random", &Thread::random)
             .add_property("chunk_onset", &Thread::getChunkOnset)
             .add_property("chunk_offset", &Thread::getChunkOffset);
@@ -80,20 +80,27 @@ BOOST_PYTHON_MODULE(core) {
     class_<Thread::Random>("Random")
             .def("sample", &Thread::Random::sample)
             .def("sampleIntFromUniformDistribution", &Thread::Random::sampleIntFromUniformDistribution)
+            .def("sampleIntFromGeometricDistribution", &Thread::Random::sampleIntFromGeometricDistribution)
             .def("sampleIntFromDiscreteDistribution", &Thread::Random::sampleIntFromDiscreteDistribution);
 
     class_<VariationSourceWrapper, boost::noncopyable>("VariationSource", init<const Configuration &>())
             .def("__copy__", pure_virtual(&VariationSourceWrapper::clone), return_value_policy<manage_new_object>())
             .def("setup", &VariationSourceWrapper::setup)
+            .def("prepare", &VariationSourceWrapper::prepare, &VariationSourceWrapper::default_prepare)
+            .def("finish", &VariationSourceWrapper::finish, &VariationSourceWrapper::default_finish)
             .def("expectedSources", pure_virtual(&VariationSourceWrapper::expectedSources))
             .def("perform", pure_virtual(&VariationSourceWrapper::perform));
 
     class_<SelectionOperatorWrapper, bases<VariationSourceWrapper>, boost::noncopyable>("SelectionOperator", init<const Configuration &>())
             .def("__copy__", pure_virtual(&SelectionOperatorWrapper::clone), return_value_policy<manage_new_object>())
+            .def("prepare", &SelectionOperatorWrapper::prepare, &SelectionOperatorWrapper::default_prepare)
+            .def("finish", &SelectionOperatorWrapper::finish, &SelectionOperatorWrapper::default_finish)
             .def("select", pure_virtual(&SelectionOperatorWrapper::select), return_internal_reference<>());
 
     class_<BreedingOperatorWrapper, bases<VariationSourceWrapper>, boost::noncopyable>("BreedingOperator", init<const Configuration &>())
             .def("__copy__", pure_virtual(&BreedingOperatorWrapper::clone), return_value_policy<manage_new_object>())
+            .def("prepare", &BreedingOperatorWrapper::prepare, &BreedingOperatorWrapper::default_prepare)
+            .def("finish", &BreedingOperatorWrapper::finish, &BreedingOperatorWrapper::default_finish)
             .def("expectedSources", pure_virtual(&BreedingOperatorWrapper::expectedSources))
             .def("breed", pure_virtual(&BreedingOperatorWrapper::breed), return_internal_reference<>());
 
@@ -115,8 +122,42 @@ BOOST_PYTHON_MODULE(core) {
             .def("mostRelevantFitness", &Statistics::mostRelevantFitness)
             .def("leastRelevantFitness", &Statistics::leastRelevantFitness);
 
-    class_<EvolutionarySystem>("EvolutionarySystem", init<const Configuration &, Builder &, EvaluationFunction &, EvolutionaryNetwork &, BreedingOperator &>())
+    enum_<Statistics::Series>("Series")
+            .value("BEST_COST", Statistics::BEST_COST)
+            .value("AVERAGE_COST", Statistics::AVERAGE_COST)
+            .value("WORST_COST", Statistics::WORST_COST)
+            .value("BEST_FITNESS", Statistics::BEST_FITNESS)
+            .value("AVERAGE_FITNESS", Statistics::AVERAGE_FITNESS)
+            .value("WORST_FITNESS", Statistics::WORST_FITNESS)
+            .value("BEST_RELEVANCE", Statistics::BEST_RELEVANCE)
+            .value("AVERAGE_RELEVANCE", Statistics::AVERAGE_RELEVANCE)
+            .value("WORST_RELEVANCE", Statistics::WORST_RELEVANCE)
+            .value("MOST_RELEVANT_COST", Statistics::MOST_RELEVANT_COST)
+            .value("LEAST_RELEVANT_COST", Statistics::LEAST_RELEVANT_COST)
+            .value("MOST_RELEVANT_FITNESS", Statistics::MOST_RELEVANT_FITNESS)
+            .value("LEAST_RELEVANT_FITNESS", Statistics::LEAST_RELEVANT_FITNESS)
+            .value("ALL_SERIES", Statistics::ALL_SERIES);
+
+    class_<EvolutionaryNetwork, boost::noncopyable>("EvolutionaryNetwork", no_init)
+            .def("__copy__", &EvolutionaryNetwork::clone, return_value_policy<manage_new_object>());
+
+    class_<FitnessCache, boost::noncopyable>("FitnessCache", init<unsigned int, unsigned int>())
+            .add_property("hits", &FitnessCache::getHits)
+            .add_property("misses", &FitnessCache::getMisses)
+            .add_property("hitrate", &FitnessCache::getHitRate);
+
+    class_<ReplayMemory, boost::noncopyable>("ReplayMemory", init<unsigned int>())
+            .add_property("size", &ReplayMemory::getSize)
+            .add_property("capacity", &ReplayMemory::getCapacity);
+
+    class_<PrioritizedReplayMemory, bases<ReplayMemory>, boost::noncopyable>("PrioritizedReplayMemory", init<unsigned int, float>())
+            .add_property("total", &PrioritizedReplayMemory::getTotalPriority);
+
+    class_<EvolutionarySystem, boost::noncopyable>("EvolutionarySystem", init<const Configuration &, Builder &, EvaluationFunction &, EvolutionaryNetwork &, BreedingOperator &>())
             .add_property("statistics", make_function(&EvolutionarySystem::getStatistics, return_internal_reference<>()))
+            .add_property("cache", make_function(&EvolutionarySystem::getFitnessCache, return_internal_reference<>()))
+            .add_property("memory", make_function(&EvolutionarySystem::getReplayMemory, return_internal_reference<>()))
+            .add_property("skipped", &EvolutionarySystem::getSkippedEvaluations)
             .def("run", &EvolutionarySystem::run);
 
     Configuration::ProblemConfiguration& (Problem::*problem)() = &Problem::getConfiguration;
@@ -132,26 +173,46 @@ BOOST_PYTHON_MODULE(core) {
             .def_readwrite("complete", &Configuration::EvolutionarySystemConfiguration::complete)
             .def_readwrite("epochs", &Configuration::EvolutionarySystemConfiguration::epochs)
             .def_readwrite("episodes", &Configuration::EvolutionarySystemConfiguration::episodes)
-            .def_readwrite("generations", &Configuration::EvolutionarySystemConfiguration::generations);
+            .def_readwrite("generations", &Configuration::EvolutionarySystemConfiguration::generations)
+            .def_readwrite("concurrency", &Configuration::EvolutionarySystemConfiguration::concurrency)
+            .def_readwrite("seed", &Configuration::EvolutionarySystemConfiguration::seed);
 
     class_<Configuration::InitializerConfiguration>("InitializerConfiguration", init<>())
             .def_readwrite("threads", &Configuration::InitializerConfiguration::threads);
 
     class_<Configuration::EvaluatorConfiguration>("EvaluatorConfiguration", init<>())
-            .def_readwrite("threads", &Configuration::EvaluatorConfiguration::threads);
+            .def_readwrite("threads", &Configuration::EvaluatorConfiguration::threads)
+            .def_readwrite("grainsize", &Configuration::EvaluatorConfiguration::grainsize)
+            .def_readwrite("stealing", &Configuration::EvaluatorConfiguration::stealing)
+            .def_readwrite("cache", &Configuration::EvaluatorConfiguration::cache)
+            .def_readwrite("shards", &Configuration::EvaluatorConfiguration::shards);
 
     class_<Configuration::BreederConfiguration>("BreederConfiguration", init<>())
             .def_readwrite("threads", &Configuration::BreederConfiguration::threads);
 
+    class_<Configuration::ReplayerConfiguration>("ReplayerConfiguration", init<>())
+            .def_readwrite("threads", &Configuration::ReplayerConfiguration::threads)
+            .def_readwrite("asynchronous", &Configuration::ReplayerConfiguration::asynchronous)
+            .def_readwrite("capacity", &Configuration::ReplayerConfiguration::capacity)
+            .def_readwrite("minibatch", &Configuration::ReplayerConfiguration::minibatch)
+            .def_readwrite("prioritized", &Configuration::ReplayerConfiguration::prioritized)
+            .def_readwrite("priority_exponent", &Configuration::ReplayerConfiguration::priority_exponent);
+
     class_<Configuration::EvolutionaryNetworkConfiguration>("EvolutionaryNetworkConfiguration", init<>())
             .def_readwrite("discount_factor", &Configuration::EvolutionaryNetworkConfiguration::discount_factor)
             .def_readwrite("learning_rate", &Configuration::EvolutionaryNetworkConfiguration::learning_rate);
 
+    class_<Configuration::StatisticsConfiguration>("StatisticsConfiguration", init<>())
+            .def_readwrite("threads", &Configuration::StatisticsConfiguration::threads)
+            .def_readwrite("series", &Configuration::StatisticsConfiguration::series);
+
     Configuration::EvolutionarySystemConfiguration& (Configuration::*system)() = &Configuration::getEvolutionarySystemConfiguration;
     Configuration::InitializerConfiguration& (Configuration::*initializer)() = &Configuration::getInitializerConfiguration;
     Configuration::EvaluatorConfiguration& (Configuration::*evaluator)() = &Configuration::getEvaluatorConfiguration;
     Configuration::BreederConfiguration& (Configuration::*breeder)() = &Configuration::getBreederConfiguration;
+    Configuration::ReplayerConfiguration& (Configuration::*replayer)() = &Configuration::getReplayerConfiguration;
     Configuration::EvolutionaryNetworkConfiguration& (Configuration::*network)() = &Configuration::getEvolutionaryNetworkConfiguration;
+    Configuration::StatisticsConfiguration& (Configuration::*statistics)() = &Configuration::getStatisticsConfiguration;
 
     class_<Configuration>("Configuration", init<const Configuration::ProblemConfiguration &>())
             .add_property("problem", make_function(&Configuration::getProblemConfiguration, return_internal_reference<>()))
@@ -159,7 +220,9 @@ BOOST_PYTHON_MODULE(core) {
             .add_property("initializer", make_function(initializer, return_internal_reference<>()))
             .add_property("evaluator", make_function(evaluator, return_internal_reference<>()))
             .add_property("breeder", make_function(breeder, return_internal_reference<>()))
-            .add_property("network", make_function(network, return_internal_reference<>()));
+            .add_property("replayer", make_function(replayer, return_internal_reference<>()))
+            .add_property("network", make_function(network, return_internal_reference<>()))
+            .add_property("statistics", make_function(statistics, return_internal_reference<>()));
 
     class_<Session>("Session", init<const Problem &>())
             .def(init<const Problem &, Configuration *>())
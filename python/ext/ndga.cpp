@@ -15,7 +15,7 @@ using namespace boost::python;
  * @since   25.1.2018
  */
 BOOST_PYTHON_MODULE(ndga) {
-    class_<RandomBitVectorBuilder, bases<Builder>, boost::noncopyable>("RandomBitVectorIndividual", init<const common::Configuration &, VectorIndividual &>())
+    class_<RandomBitVectorBuilder, bases<Builder>, boost::noncopyable>("RandomBitVectorIndividual", init<const common::Configuration &, BitVectorIndividual &>())
             .def("__copy__", &RandomBitVectorBuilder::clone, return_value_policy<manage_new_object>());
 
     class_<BitVectorCrossover, bases<BreedingOperator>, boost::noncopyable>("BitVectorCrossover", init<const common::Configuration &>())
@@ -26,11 +26,11 @@ BOOST_PYTHON_MODULE(ndga) {
 
     EvolutionarySystem* (ndga::Session::*build0)() = &ndga::Session::build;
     EvolutionarySystem* (ndga::Session::*build1)(RandomBitVectorBuilder &) = &ndga::Session::build;
-    EvolutionarySystem* (ndga::Session::*build2)(TransitionTable &) = &ndga::Session::build;
+    EvolutionarySystem* (ndga::Session::*build2)(EvolutionaryNetwork &) = &ndga::Session::build;
     EvolutionarySystem* (ndga::Session::*build3)(BreedingOperator &) = &ndga::Session::build;
-    EvolutionarySystem* (ndga::Session::*build4)(RandomBitVectorBuilder &, TransitionTable &) = &ndga::Session::build;
+    EvolutionarySystem* (ndga::Session::*build4)(RandomBitVectorBuilder &, EvolutionaryNetwork &) = &ndga::Session::build;
     EvolutionarySystem* (ndga::Session::*build5)(RandomBitVectorBuilder &, BreedingOperator &) = &ndga::Session::build;
-    EvolutionarySystem* (ndga::Session::*build6)(TransitionTable &, BreedingOperator &) = &ndga::Session::build;
+    EvolutionarySystem* (ndga::Session::*build6)(EvolutionaryNetwork &, BreedingOperator &) = &ndga::Session::build;
 
     class_<ndga::Session, bases<core::Session>>("Session", init<const common::Problem &>())
             .def(init<const common::Problem &, common::Configuration *>())
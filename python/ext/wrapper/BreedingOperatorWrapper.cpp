@@ -2,6 +2,24 @@
 
 BreedingOperatorWrapper::BreedingOperatorWrapper(const core::Configuration &configuration) : BreedingOperator(configuration) {}
 
+void BreedingOperatorWrapper::prepare(Population &pop) {
+    if (override prepare = this->get_override("prepare"))
+        prepare(boost::ref(pop));
+    else
+        BreedingOperator::prepare(pop);
+}
+
+void BreedingOperatorWrapper::default_prepare(Population &pop) { this->BreedingOperator::prepare(pop); }
+
+void BreedingOperatorWrapper::finish(Population &pop) {
+    if (override finish = this->get_override("finish"))
+        finish(boost::ref(pop));
+    else
+        BreedingOperator::finish(pop);
+}
+
+void BreedingOperatorWrapper::default_finish(Population &pop) { this->BreedingOperator::finish(pop); }
+
 unsigned long BreedingOperatorWrapper::expectedSources() const {
     return this->get_override("expectedSources")();
 }
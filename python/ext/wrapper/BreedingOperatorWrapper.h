@@ -19,6 +19,11 @@ class BreedingOperatorWrapper : public BreedingOperator, public wrapper<Breeding
 public:
     explicit BreedingOperatorWrapper(const core::Configuration &configuration);
 
+    void prepare(Population &pop) override;
+    void default_prepare(Population &pop);
+    void finish(Population &pop) override;
+    void default_finish(Population &pop);
+
     unsigned long expectedSources() const override;
 
     std::vector<Individual *> & breed(std::vector<Individual *> &parents, Thread &thread) const override;
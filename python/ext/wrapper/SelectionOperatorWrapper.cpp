@@ -2,6 +2,24 @@
 
 SelectionOperatorWrapper::SelectionOperatorWrapper(const core::Configuration &configuration) : SelectionOperator(configuration) {}
 
+void SelectionOperatorWrapper::prepare(Population &pop) {
+    if (override prepare = this->get_override("prepare"))
+        prepare(boost::ref(pop));
+    else
+        SelectionOperator::prepare(pop);
+}
+
+void SelectionOperatorWrapper::default_prepare(Population &pop) { this->SelectionOperator::prepare(pop); }
+
+void SelectionOperatorWrapper::finish(Population &pop) {
+    if (override finish = this->get_override("finish"))
+        finish(boost::ref(pop));
+    else
+        SelectionOperator::finish(pop);
+}
+
+void SelectionOperatorWrapper::default_finish(Population &pop) { this->SelectionOperator::finish(pop); }
+
 Individual* SelectionOperatorWrapper::select(std::vector<Individual *> &parents, Thread &thread) const {
     return this->get_override("select")(parents, thread);
 }
@@ -19,6 +19,11 @@ class SelectionOperatorWrapper : public SelectionOperator, public wrapper<Select
 public:
     explicit SelectionOperatorWrapper(const core::Configuration &configuration);
 
+    void prepare(Population &pop) override;
+    void default_prepare(Population &pop);
+    void finish(Population &pop) override;
+    void default_finish(Population &pop);
+
     Individual * select(std::vector<Individual *> &parents, Thread &thread) const override;
 
     SelectionOperator * clone() const override;
@@ -3,6 +3,24 @@
 VariationSourceWrapper::VariationSourceWrapper(const core::Configuration &configuration)
         : VariationSource(configuration) {}
 
+void VariationSourceWrapper::prepare(Population &pop) {
+    if (override prepare = this->get_override("prepare"))
+        prepare(boost::ref(pop));
+    else
+        VariationSource::prepare(pop);
+}
+
+void VariationSourceWrapper::default_prepare(Population &pop) { this->VariationSource::prepare(pop); }
+
+void VariationSourceWrapper::finish(Population &pop) {
+    if (override finish = this->get_override("finish"))
+        finish(boost::ref(pop));
+    else
+        VariationSource::finish(pop);
+}
+
+void VariationSourceWrapper::default_finish(Population &pop) { this->VariationSource::finish(pop); }
+
 unsigned long VariationSourceWrapper::expectedSources() const {
     return this->get_override("expectedSources")();
 }
@@ -3,9 +3,15 @@
 #include "../core/util/Thread.h"
 #include "../cc/common/Problem.h"
 #include "../cc/common/FeatureVector.h"
+#include "../cc/common/BitVectorIndividual.h"
 #include "../cc/common/VectorIndividual.h"
 #include "../core/representation/Population.h"
 #include "../cc/common/FitnessProportionateSelection.h"
+#include "../cc/common/TransitionTable.h"
+#include "../cc/common/MultilayerPerceptron.h"
+#include "../cc/common/LinearApproximator.h"
+#include "../core/experience/AsynchronousNetwork.h"
+#include "../core/experience/PrioritizedReplayMemory.h"
 #include "util/SimpleEvaluationFunction.h"
 
 /**
@@ -32,6 +38,41 @@ TEST_CASE("Common", "[common]") {
                           chromosome.end(),
                           features.begin()));
         }
+
+        SECTION("Checking batched extraction...") {
+            Relevance r(*configuration);
+            std::vector<Individual *> individuals;
+            for (unsigned int k = 0; k < 7; k++) {
+                auto *bitvector = new BitVectorIndividual(*configuration, *featurevector, r);
+                bitvector->setGene(k, true);
+                individuals.push_back(bitvector);
+            }
+            REQUIRE(featurevector->getDimension() == 8);
+
+            Matrix sequential;
+            featurevector->extractBatch(individuals, 2, 5, sequential);
+            REQUIRE(sequential.getRows() == 5);
+            REQUIRE(sequential.getColumns() == 8);
+            for (unsigned int k = 0; k < 5; k++) {
+                for (unsigned int l = 0; l < 8; l++)
+                    REQUIRE(sequential.row(k)[l] == (l == k + 2 ? 1 : 0));
+            }
+
+            common::Configuration c(*configuration);
+            c.getEvaluatorConfiguration().threads = 3;
+            ThreadPool pool(c);
+            Matrix concurrent;
+            featurevector->extractBatch(individuals, concurrent, pool);
+            REQUIRE(concurrent.getRows() == 7);
+            for (unsigned int k = 0; k < 7; k++) {
+                REQUIRE(reinterpret_cast<std::uintptr_t>(concurrent.row(k)) % Matrix::ALIGNMENT == 0);
+                for (unsigned int l = 0; l < 8; l++)
+                    REQUIRE(concurrent.row(k)[l] == (l == k ? 1 : 0));
+            }
+
+            for (auto *bitvector : individuals)
+                delete bitvector;
+        }
     }
 
     auto *relevance = new Relevance(*configuration);
@@ -75,17 +116,377 @@ TEST_CASE("Common", "[common]") {
         }
     }
 
+    SECTION("BitVectorIndividual") {
+        auto *p = new common::Problem(*eval, 3, 70);
+        auto *c = new common::Configuration(dynamic_cast<common::Configuration::ProblemConfiguration &>(p->getConfiguration()));
+        auto *bitvector = new BitVectorIndividual(*c, *featurevector, *relevance);
+        bitvector->setGene(1, true);
+        bitvector->setGene(63, true);
+        bitvector->setGene(64, true);
+        bitvector->setGene(69, true);
+        bitvector->flipGene(69);
+
+        SECTION("Checking bit packing...") {
+            REQUIRE(bitvector->getChromosome().size() == 2);
+            REQUIRE(bitvector->getChromosome().at(0) == (std::uint64_t(1) << 1 | std::uint64_t(1) << 63));
+            REQUIRE(bitvector->getChromosome().at(1) == 1);
+            REQUIRE(bitvector->getTailMask() == 0x3F);
+            REQUIRE(bitvector->countOnes() == 3);
+        }
+
+        SECTION("Checking human-readable bit vector representation...") {
+            std::string str(70, '0');
+            str.at(1) = '1';
+            str.at(63) = '1';
+            str.at(64) = '1';
+            REQUIRE(bitvector->toString() == str);
+        }
+
+        SECTION("Checking cloning...") {
+            auto *copy = bitvector->clone();
+            REQUIRE(&bitvector->getChromosome() != &copy->getChromosome());
+            REQUIRE(bitvector->getChromosome() == copy->getChromosome());
+            delete copy;
+        }
+
+        delete bitvector;
+        delete c;
+        delete p;
+    }
+
+    SECTION("CostTable") {
+        SECTION("Checking sparse storage...") {
+            CostTable table;
+            REQUIRE(table.get(42) == 0);
+            for (unsigned long long k = 0; k < 1000; k++)
+                table.set(k << 40, k);
+            REQUIRE(table.getSize() == 1000);
+            REQUIRE(!table.contains(1));
+            for (unsigned long long k = 0; k < 1000; k++)
+                REQUIRE(table.get(k << 40) == k);
+        }
+
+        SECTION("Checking eviction...") {
+            CostTable table(2);
+            table.set(1, 1);
+            table.set(2, 2);
+            table.set(3, 3);
+            REQUIRE(table.getSize() == 2);
+            REQUIRE(table.get(3) == 3);
+            REQUIRE(table.contains(1) != table.contains(2));
+
+            // The clock hand always finds a victim, so the table never exceeds its capacity.
+            for (unsigned long long k = 4; k < 100; k++) {
+                table.set(k, k);
+                REQUIRE(table.getSize() == 2);
+                REQUIRE(table.get(k) == k);
+            }
+        }
+    }
+
+    SECTION("TransitionTable") {
+        auto *p = new common::Problem(*eval, 3, 70);
+        auto *c = new common::Configuration(dynamic_cast<common::Configuration::ProblemConfiguration &>(p->getConfiguration()));
+        auto *network = new TransitionTable(*c);
+        std::vector<Individual *> parents;
+        std::vector<Individual *> offsprings;
+        for (unsigned int k = 0; k < 3; k++) {
+            auto *parent = new BitVectorIndividual(*c, *featurevector, *relevance);
+            parent->setGene(k, true);
+            parent->getRelevance().setFitness(k);
+            parents.push_back(parent);
+            auto *offspring = parent->clone();
+            offspring->flipGene(66);
+            offsprings.push_back(offspring);
+        }
+
+        SECTION("Checking updates of visited states...") {
+            network->update(parents, offsprings);
+            std::vector<float> precosts = network->output(parents);
+            std::vector<float> postcosts = network->output(offsprings);
+            REQUIRE(precosts.at(0) == 0);
+            REQUIRE(precosts.at(1) == Approx(0.1f));
+            REQUIRE(precosts.at(2) == Approx(0.2f));
+            REQUIRE(postcosts == std::vector<float>(3, 0));
+        }
+
+        SECTION("Checking estimation by ranges...") {
+            network->update(parents, offsprings);
+            std::vector<float> precosts = network->output(parents);
+            network->estimate(parents, 0, 1);
+            network->estimate(parents, 1, 2);
+            for (unsigned int k = 0; k < 3; k++)
+                REQUIRE(parents.at(k)->getRelevance().getCost() == precosts.at(k));
+        }
+
+        SECTION("Checking updates by chunks...") {
+            REQUIRE(network->isPartitioned());
+            auto *chunked = dynamic_cast<TransitionTable *>(network->clone());
+            network->update(parents, offsprings);
+            chunked->estimate(parents, 0, 3);
+            chunked->updateChunk(parents, offsprings, 0, 1);
+            chunked->updateChunk(parents, offsprings, 1, 2);
+            REQUIRE(chunked->output(parents) == network->output(parents));
+            REQUIRE(chunked->output(offsprings) == network->output(offsprings));
+            delete chunked;
+        }
+
+        SECTION("Checking replayed transitions...") {
+            auto *replayed = dynamic_cast<TransitionTable *>(network->clone());
+            std::vector<Transition> transitions;
+            REQUIRE(replayed->record(parents, offsprings, transitions));
+            REQUIRE(transitions.size() == 3);
+            REQUIRE(transitions.at(2).slot == 2);
+            REQUIRE(transitions.at(2).fitness == 2);
+            REQUIRE(transitions.at(2).state != transitions.at(2).next);
+
+            std::vector<float> precosts = network->output(parents);
+            network->update(parents, offsprings);
+            std::vector<float> errors;
+            replayed->learn(transitions, errors);
+            REQUIRE(errors.size() == 3);
+            REQUIRE(errors.at(0) == 0);
+            REQUIRE(errors.at(2) == Approx(2.0f - precosts.at(2)));
+            REQUIRE(replayed->output(parents) == network->output(parents));
+            REQUIRE(replayed->output(offsprings) == network->output(offsprings));
+            delete replayed;
+        }
+
+        SECTION("Checking asynchronous training...") {
+            auto *asynchronous = new AsynchronousNetwork(*c, network->clone());
+            asynchronous->update(parents, offsprings);
+            REQUIRE(asynchronous->output(parents) == std::vector<float>(3, 0));
+            network->update(parents, offsprings);
+            asynchronous->update(parents, offsprings);
+            REQUIRE(asynchronous->output(parents) == network->output(parents));
+
+            network->update(parents, offsprings);
+            asynchronous->flush();
+            REQUIRE(asynchronous->output(parents) == network->output(parents));
+            asynchronous->update(parents, offsprings);
+            asynchronous->flush();
+            network->update(parents, offsprings);
+            REQUIRE(asynchronous->output(parents) == network->output(parents));
+            delete asynchronous;
+        }
+
+        for (unsigned int k = 0; k < 3; k++) {
+            delete parents.at(k);
+            delete offsprings.at(k);
+        }
+        delete network;
+        delete c;
+        delete p;
+    }
+
+    SECTION("MultilayerPerceptron") {
+        auto *p = new common::Problem(*eval, 20, 70);
+        auto *c = new common::Configuration(dynamic_cast<common::Configuration::ProblemConfiguration &>(p->getConfiguration()));
+        c->getEvolutionaryNetworkConfiguration().learning_rate = 0.05f;
+        auto *network = new MultilayerPerceptron(*c);
+        auto *fv = new FeatureVector(*c);
+        std::vector<Individual *> parents;
+        std::vector<Individual *> offsprings;
+        for (unsigned int k = 0; k < 20; k++) {
+            auto *parent = new BitVectorIndividual(*c, *fv, *relevance);
+            for (unsigned int l = 0; l < 70; l += k + 1)
+                parent->setGene(l, true);
+            parent->getRelevance().setFitness(k % 4);
+            parents.push_back(parent);
+            auto *offspring = parent->clone();
+            offspring->flipGene(69);
+            offsprings.push_back(offspring);
+        }
+
+        SECTION("Checking estimation by ranges...") {
+            std::vector<float> costs = network->output(parents);
+            network->estimate(parents, 0, 7);
+            network->estimate(parents, 7, 13);
+            for (unsigned int k = 0; k < 20; k++)
+                REQUIRE(parents.at(k)->getRelevance().getCost() == Approx(costs.at(k)));
+
+            auto *copy = network->clone();
+            REQUIRE(copy->output(parents) == costs);
+            delete copy;
+        }
+
+        SECTION("Checking temporal difference learning...") {
+            auto loss = [&]() {
+                std::vector<float> precosts = network->output(parents);
+                std::vector<float> postcosts = network->output(offsprings);
+                float sum = 0;
+                for (unsigned int k = 0; k < 20; k++) {
+                    float fitness = parents.at(k)->getRelevance().getFitness();
+                    float error = fitness > 0 ? fitness + 0.1f * postcosts.at(k) - precosts.at(k) : 0;
+                    sum += error * error;
+                }
+                return sum;
+            };
+
+            float initial = loss();
+            for (unsigned int k = 0; k < 200; k++)
+                network->update(parents, offsprings);
+            REQUIRE(loss() < 0.1f * initial);
+        }
+
+        for (unsigned int k = 0; k < 20; k++) {
+            delete parents.at(k);
+            delete offsprings.at(k);
+        }
+        delete fv;
+        delete network;
+        delete c;
+        delete p;
+    }
+
+    SECTION("LinearApproximator") {
+        auto *p = new common::Problem(*eval, 3, 70);
+        auto *c = new common::Configuration(dynamic_cast<common::Configuration::ProblemConfiguration &>(p->getConfiguration()));
+        c->getLinearApproximatorConfiguration().bits = 12;
+        c->getLinearApproximatorConfiguration().ngram = 2;
+        c->getEvolutionaryNetworkConfiguration().learning_rate = 0.5f;
+        auto *network = new LinearApproximator(*c);
+        std::vector<Individual *> parents;
+        std::vector<Individual *> offsprings;
+        for (unsigned int k = 0; k < 3; k++) {
+            auto *parent = new BitVectorIndividual(*c, *featurevector, *relevance);
+            parent->setGene(k, true);
+            parent->getRelevance().setFitness(k);
+            parents.push_back(parent);
+            auto *offspring = parent->clone();
+            offspring->flipGene(66);
+            offsprings.push_back(offspring);
+        }
+
+        SECTION("Checking active features...") {
+            std::vector<unsigned long long> features;
+            auto *parent = dynamic_cast<BitVectorIndividual *>(parents.at(1));
+            featurevector->activate(parent->getChromosome(), 70, 2, features);
+            REQUIRE(features.size() == 69);
+            REQUIRE(features.at(0) == (0ull << 2 | 1));
+            REQUIRE(features.at(1) == (1ull << 2 | 2));
+            REQUIRE(features.at(2) == (2ull << 2 | 0));
+
+            std::vector<float> chromosome = {0, 1, 0};
+            std::vector<unsigned long long> dense;
+            featurevector->activate(chromosome, 2, dense);
+            REQUIRE(dense == std::vector<unsigned long long>({1, 1ull << 2 | 2}));
+        }
+
+        SECTION("Checking updates of visited states...") {
+            REQUIRE(network->output(parents) == std::vector<float>(3, 0));
+            network->update(parents, offsprings);
+            std::vector<float> precosts = network->output(parents);
+            // The ideal parent is not learned, but it shares most of its windows with the others.
+            REQUIRE(precosts.at(0) > 0);
+            REQUIRE(precosts.at(1) > precosts.at(0));
+            REQUIRE(precosts.at(2) > precosts.at(1));
+
+            for (unsigned int k = 0; k < 2000; k++)
+                network->update(parents, offsprings);
+            precosts = network->output(parents);
+            std::vector<float> postcosts = network->output(offsprings);
+            for (unsigned int k = 1; k < 3; k++)
+                REQUIRE(precosts.at(k) == Approx(k + 0.1f * postcosts.at(k)).epsilon(0.01));
+
+            auto *copy = network->clone();
+            REQUIRE(copy->output(parents) == precosts);
+            delete copy;
+        }
+
+        for (unsigned int k = 0; k < 3; k++) {
+            delete parents.at(k);
+            delete offsprings.at(k);
+        }
+        delete network;
+        delete c;
+        delete p;
+    }
+
+    SECTION("ReplayMemory") {
+        ReplayMemory memory(3);
+        Thread thread(0, 1);
+        std::vector<Transition> minibatch;
+        std::vector<unsigned long> indices;
+        memory.sample(minibatch, indices, 4, thread.random);
+        REQUIRE(minibatch.empty());
+
+        std::vector<Transition> transitions(5);
+        for (unsigned int k = 0; k < 5; k++)
+            transitions.at(k).state = k;
+        memory.append(transitions);
+        REQUIRE(memory.getSize() == 3);
+
+        // The two oldest transitions have been overwritten.
+        std::vector<bool> sampled(5, false);
+        for (unsigned int k = 0; k < 100; k++) {
+            memory.sample(minibatch, indices, 4, thread.random);
+            REQUIRE(minibatch.size() == 4);
+            for (unsigned int l = 0; l < 4; l++) {
+                sampled.at(minibatch.at(l).state) = true;
+                REQUIRE(minibatch.at(l).state == (indices.at(l) + 1) % 3 + 2);
+            }
+        }
+        REQUIRE(sampled == std::vector<bool>({false, false, true, true, true}));
+    }
+
+    SECTION("SumTree") {
+        SumTree tree(5);
+        std::vector<double> priorities = {1, 0, 2, 3, 4};
+        for (unsigned long k = 0; k < priorities.size(); k++)
+            tree.set(k, priorities.at(k));
+        REQUIRE(tree.getTotal() == 10);
+        REQUIRE(tree.find(0) == 0);
+        REQUIRE(tree.find(0.99) == 0);
+        REQUIRE(tree.find(1) == 2);
+        REQUIRE(tree.find(5.5) == 3);
+        REQUIRE(tree.find(9.99) == 4);
+        REQUIRE(tree.find(10) == 4);
+
+        tree.set(4, 0);
+        REQUIRE(tree.getTotal() == 6);
+        REQUIRE(tree.get(4) == 0);
+        REQUIRE(tree.find(6) == 3);
+    }
+
+    SECTION("PrioritizedReplayMemory") {
+        PrioritizedReplayMemory memory(4, 1);
+        Thread thread(0, 1);
+        std::vector<Transition> transitions(4);
+        for (unsigned int k = 0; k < 4; k++)
+            transitions.at(k).state = k;
+        memory.append(transitions);
+        REQUIRE(memory.getTotalPriority() == 4);
+
+        memory.prioritize({0, 1, 2, 3}, {0, -9, 0, 0});
+        REQUIRE(memory.getTotalPriority() == Approx(9.004));
+
+        // Appended transitions start with the maximum priority, which is found at the overwritten position.
+        memory.append(std::vector<Transition>(1));
+        std::vector<Transition> minibatch;
+        std::vector<unsigned long> indices;
+        std::vector<unsigned int> counts(4, 0);
+        for (unsigned int k = 0; k < 1000; k++) {
+            memory.sample(minibatch, indices, 2, thread.random);
+            for (auto index : indices)
+                counts.at(index) += 1;
+        }
+        REQUIRE(counts.at(0) + counts.at(1) > 1990);
+        REQUIRE(counts.at(0) > 900);
+        REQUIRE(counts.at(1) > 900);
+    }
+
     delete featurevector;
     delete relevance;
 
     auto *pop = new Population(*configuration);
-    pop->getIndividuals().at(0) = individual->clone();
+    pop->setIndividual(0, individual->clone());
     pop->getIndividuals().at(0)->getRelevance().setCost(10);
     pop->getIndividuals().at(0)->getRelevance().setFitness(0);
-    pop->getIndividuals().at(1) = individual->clone();
+    pop->setIndividual(1, individual->clone());
     pop->getIndividuals().at(1)->getRelevance().setCost(5);
     pop->getIndividuals().at(1)->getRelevance().setFitness(5);
-    pop->getIndividuals().at(2) = individual->clone();
+    pop->setIndividual(2, individual->clone());
     pop->getIndividuals().at(2)->getRelevance().setCost(0);
     pop->getIndividuals().at(2)->getRelevance().setFitness(10);
     configuration->getEvolutionarySystemConfiguration().epochs = 2;
@@ -163,6 +564,32 @@ TEST_CASE("Common", "[common]") {
             REQUIRE(counts.at(1) < counts.at(2));
         }
 
+        counts.at(0) = 0;
+        counts.at(1) = 0;
+        counts.at(2) = 0;
+        SECTION("Checking selection from a finished alias table...") {
+            pop->getIndividuals().at(0)->getRelevance().setFraction(0);
+            pop->getIndividuals().at(1)->getRelevance().setFraction(0);
+            pop->getIndividuals().at(2)->getRelevance().setFraction(0);
+            so->prepare(*pop);
+            so->finish(*pop);
+            pop->getIndividuals().at(0)->getRelevance().setFraction(1);
+            pop->getIndividuals().at(1)->getRelevance().setFraction(1);
+            pop->getIndividuals().at(2)->getRelevance().setFraction(1);
+
+            for (unsigned int k = 1; k <= 1000; k++) {
+                selected = so->select(pop->getIndividuals(), *thread);
+                for (unsigned int l = 0; l < counts.size(); l++) {
+                    if (selected == pop->getIndividuals().at(l)) {
+                        counts.at(l) += 1;
+                    }
+                }
+            }
+
+            REQUIRE(counts.at(0) < counts.at(1));
+            REQUIRE(counts.at(1) < counts.at(2));
+        }
+
         delete thread;
         delete so;
     }
@@ -1,14 +1,19 @@
 #define CATCH_CONFIG_MAIN
 
 
+#include <cmath>
 #include <catch.hpp>
 #include "util/SimpleBuilder.h"
 #include "../core/representation/Population.h"
+#include "../core/representation/IndividualPool.h"
 #include "util/SimpleVariationSource.h"
 #include "util/SimpleIndividual.h"
+#include "util/SimpleRelevance.h"
 #include "util/SimpleSelectionOperator.h"
 #include "util/SimpleBreedingOperator.h"
 #include "../core/initialization/Initializer.h"
+#include "../core/util/ThreadPool.h"
+#include "../core/util/Matrix.h"
 #include "../core/evaluation/Evaluator.h"
 #include "../core/variation/Breeder.h"
 #include "../core/statistics/Statistics.h"
@@ -119,6 +124,31 @@ TEST_CASE("Core", "[core]") {
         }
     }
 
+    SECTION("IndividualPool") {
+        individual->getRelevance().setFitness(2.5);
+        individual->setLabel("original");
+
+        SECTION("Checking recycling...") {
+            auto *individualpool = new IndividualPool();
+            Individual *copy = individualpool->acquire(*individual);
+            REQUIRE(copy != individual);
+            REQUIRE(copy->toString() == "original");
+
+            individualpool->release(copy);
+            REQUIRE(individualpool->getSize() == 1);
+            individual->setLabel("recycled");
+            individual->getRelevance().setFitness(1.5);
+            Individual *recycled = individualpool->acquire(*individual);
+            REQUIRE(recycled == copy);
+            REQUIRE(recycled->toString() == "recycled");
+            REQUIRE(recycled->getRelevance().getFitness() == 1.5);
+            REQUIRE(individualpool->getSize() == 0);
+
+            delete recycled;
+            delete individualpool;
+        }
+    }
+
     delete featuremap;
     delete relevance;
 
@@ -162,6 +192,71 @@ TEST_CASE("Core", "[core]") {
             REQUIRE(counts.at(0) > counts.at(1));
             REQUIRE(counts.at(1) > counts.at(2));
         }
+
+        SECTION("Checking counter-based generator...") {
+            Philox generator(0);
+            REQUIRE(generator() == 0x6627e8d5);
+            REQUIRE(generator() == 0xe169c58d);
+            REQUIRE(generator() == 0xbc57ac4c);
+            REQUIRE(generator() == 0x9b00dbd8);
+
+            std::vector<Philox::result_type> words(10);
+            generator.seed(0, 0, 0, 0);
+            generator();
+            generator.fill(words.data(), words.size());
+            Philox reference(0);
+            reference();
+            for (auto word : words)
+                REQUIRE(word == reference());
+        }
+
+        SECTION("Checking resolution of uniform samples...") {
+            Clock clock;
+            auto *other = new Thread(0, 3);
+            thread->random.seed(clock, 0, Thread::Random::VARIATION);
+            other->random.seed(clock, 0, Thread::Random::VARIATION);
+            std::vector<double> samples(300);
+            thread->random.fill(samples);
+            unsigned int fine = 0;
+            for (double s : samples) {
+                REQUIRE(s == other->random.sample());
+                REQUIRE(s >= 0);
+                REQUIRE(s < 1);
+                if (s * 16777216.0 != std::floor(s * 16777216.0))
+                    fine++;
+            }
+            REQUIRE(fine > 290);
+            delete other;
+        }
+
+        SECTION("Checking reproducible random streams...") {
+            Clock clock;
+            clock.seed = 42;
+            clock.generation = 3;
+            auto *other = new Thread(0, 3);
+            thread->random.seed(clock, 1, Thread::Random::VARIATION);
+            other->random.sample();
+            other->random.seed(clock, 1, Thread::Random::VARIATION);
+            std::vector<std::uint64_t> words(3);
+            thread->random.fill(words);
+            REQUIRE(words.at(0) == other->random.sampleWord());
+            REQUIRE(words.at(1) == other->random.sampleWord());
+            REQUIRE(words.at(2) == other->random.sampleWord());
+
+            other->random.seed(clock, 2, Thread::Random::VARIATION);
+            thread->random.seed(clock, 1, Thread::Random::VARIATION);
+            REQUIRE(thread->random.sampleWord() != other->random.sampleWord());
+
+            Clock distant = clock;
+            distant.episode = clock.episode + (1u << 30);
+            other->random.seed(distant, 1, Thread::Random::VARIATION);
+            thread->random.seed(clock, 1, Thread::Random::VARIATION);
+            REQUIRE(thread->random.sampleWord() != other->random.sampleWord());
+            other->random.seed(clock, 1, Thread::Random::EVALUATION);
+            thread->random.seed(clock, 1, Thread::Random::VARIATION);
+            REQUIRE(thread->random.sampleWord() != other->random.sampleWord());
+            delete other;
+        }
     }
 
     auto *builder = new SimpleBuilder(configuration, *individual);
@@ -180,9 +275,9 @@ TEST_CASE("Core", "[core]") {
     problem->getConfiguration().popsize = 3;
     auto *pop = new Population(configuration);
     SECTION("Population") {
-        pop->getIndividuals().at(0) = builder->build(*thread);
-        pop->getIndividuals().at(1) = builder->build(*thread);
-        pop->getIndividuals().at(2) = builder->build(*thread);
+        pop->setIndividual(0, builder->build(*thread));
+        pop->setIndividual(1, builder->build(*thread));
+        pop->setIndividual(2, builder->build(*thread));
 
         SECTION("Checking extermination...") {
             pop->exterminate();
@@ -191,16 +286,48 @@ TEST_CASE("Core", "[core]") {
             }
         }
 
-        pop->getIndividuals().at(0) = builder->build(*thread);
+        pop->setIndividual(0, builder->build(*thread));
         pop->getIndividuals().at(0)->getRelevance().setCost(0);
         pop->getIndividuals().at(0)->getRelevance().setFitness(0);
-        pop->getIndividuals().at(1) = builder->build(*thread);
+        pop->setIndividual(1, builder->build(*thread));
         pop->getIndividuals().at(1)->getRelevance().setCost(3);
         pop->getIndividuals().at(1)->getRelevance().setFitness(5);
-        pop->getIndividuals().at(2) = builder->build(*thread);
+        pop->setIndividual(2, builder->build(*thread));
         pop->getIndividuals().at(2)->getRelevance().setCost(7.5);
         pop->getIndividuals().at(2)->getRelevance().setFitness(2.5);
 
+        SECTION("Checking relevance arrays...") {
+            REQUIRE(pop->getCosts().at(1) == 3);
+            REQUIRE(pop->getFitnesses().at(2) == 2.5);
+            pop->getIndividuals().at(1)->getRelevance().setCost(4);
+            REQUIRE(pop->getCosts().at(1) == 4);
+
+            Individual *unbound = pop->getIndividuals().at(1);
+            pop->setIndividual(1, nullptr);
+            unbound->getRelevance().setCost(6);
+            REQUIRE(unbound->getRelevance().getCost() == 6);
+            REQUIRE(pop->getCosts().at(1) == 4);
+            delete unbound;
+        }
+
+        SECTION("Swapping generations...") {
+            Individual *parent = pop->getIndividuals().at(1);
+            Individual *offspring = parent->clone();
+            pop->setOffspring(1, offspring);
+            offspring->getRelevance().setCost(1);
+            REQUIRE(pop->getCosts().at(1) == 3);
+
+            pop->swap();
+            REQUIRE(pop->getIndividuals().at(1) == offspring);
+            REQUIRE(pop->getOffsprings().at(1) == parent);
+            REQUIRE(pop->getCosts().at(1) == 1);
+            REQUIRE(pop->getFitnesses().at(1) == 5);
+            REQUIRE(pop->getIndividuals().at(0) == nullptr);
+            pop->swap();
+            REQUIRE(pop->getIndividuals().at(1) == parent);
+            REQUIRE(pop->getCosts().at(1) == 3);
+        }
+
         SECTION("Finding the best individual...") {
             pop->getIndividuals().at(0)->getRelevance().setFraction(0);
             pop->getIndividuals().at(1)->getRelevance().setFraction(0);
@@ -231,6 +358,45 @@ TEST_CASE("Core", "[core]") {
             REQUIRE(pop->worstIndividual() == pop->getIndividuals().at(2));
         }
 
+        SECTION("Comparing overridden relevances...") {
+            auto *simple_featuremap = new SimpleFeatureMap(configuration);
+            auto *simple_relevance = new SimpleRelevance(configuration);
+            auto *simple_individual = new SimpleIndividual(configuration, *simple_featuremap, *simple_relevance);
+            for (unsigned int k = 0; k < 3; k++) {
+                float cost = pop->getCosts().at(k);
+                float fitness = pop->getFitnesses().at(k);
+                Individual *conventional = pop->getIndividuals().at(k);
+                pop->setIndividual(k, simple_individual->clone());
+                delete conventional;
+                pop->getIndividuals().at(k)->getRelevance().setCost(cost);
+                pop->getIndividuals().at(k)->getRelevance().setFitness(fitness);
+                pop->getIndividuals().at(k)->getRelevance().setFraction(0);
+            }
+            REQUIRE(pop->bestIndividual() == pop->getIndividuals().at(0));
+            REQUIRE(pop->worstIndividual() == pop->getIndividuals().at(2));
+
+            configuration.getEvolutionarySystemConfiguration().epochs = 1;
+            configuration.getEvolutionarySystemConfiguration().episodes = 1;
+            configuration.getEvolutionarySystemConfiguration().generations = 0;
+            configuration.getStatisticsConfiguration().threads = 3;
+            auto *statistics_pool = new ThreadPool(configuration);
+            auto *statistics = new Statistics(configuration, *statistics_pool);
+            statistics->record(*pop, 0, 0);
+            REQUIRE(statistics->mostRelevantCost(0).at(0) == 0);
+            REQUIRE(statistics->mostRelevantFitness(0).at(0) == 0);
+            REQUIRE(statistics->bestRelevance(0).at(0) == 0);
+            REQUIRE(statistics->leastRelevantCost(0).at(0) == 7.5f);
+            REQUIRE(statistics->leastRelevantFitness(0).at(0) == 2.5f);
+            REQUIRE(statistics->worstRelevance(0).at(0) == 2.5f);
+            delete statistics;
+            delete statistics_pool;
+            configuration.getStatisticsConfiguration().threads = 1;
+
+            delete simple_individual;
+            delete simple_relevance;
+            delete simple_featuremap;
+        }
+
         SECTION("Computing the average individual...") {
             auto *average = pop->averageIndividual();
             average->getRelevance().setFraction(0.5);
@@ -242,7 +408,82 @@ TEST_CASE("Core", "[core]") {
     }
 
     configuration.getInitializerConfiguration().threads = 2;
-    auto *initializer = new Initializer(configuration, *builder, epoch);
+    auto *pool = new ThreadPool(configuration);
+    SECTION("ThreadPool") {
+        SECTION("Executing tasks...") {
+            std::vector<unsigned int> results(5, 0);
+            std::vector<std::function<void()>> tasks(results.size());
+            for (unsigned int k = 0; k < tasks.size(); k++) {
+                tasks.at(k) = [&results, k] { results.at(k) = k + 1; };
+            }
+            pool->execute(tasks);
+            pool->execute(tasks);
+            REQUIRE(pool->getSize() == 2);
+            for (unsigned int k = 0; k < results.size(); k++) {
+                REQUIRE(results.at(k) == k + 1);
+            }
+        }
+    }
+
+    SECTION("Matrix") {
+        SECTION("Checking aligned rows...") {
+            Matrix matrix(3, 17);
+            REQUIRE(matrix.getStride() == 32);
+            for (unsigned int k = 0; k < matrix.getRows(); k++) {
+                REQUIRE(reinterpret_cast<std::uintptr_t>(matrix.row(k)) % Matrix::ALIGNMENT == 0);
+                REQUIRE(matrix.row(k)[16] == 0);
+            }
+
+            matrix.fill(2);
+            Matrix copy(matrix);
+            REQUIRE(reinterpret_cast<std::uintptr_t>(copy.row(1)) % Matrix::ALIGNMENT == 0);
+            REQUIRE(copy.row(2)[16] == 2);
+            REQUIRE(copy.row(2)[17] == 0);
+
+            matrix.resize(2, 4);
+            REQUIRE(matrix.getStride() == 16);
+            REQUIRE(matrix.row(1)[3] == 0);
+        }
+    }
+
+    SECTION("WorkStealingScheduler") {
+        std::vector<unsigned int> counts(10, 0);
+        unsigned int onset;
+        unsigned int offset;
+
+        SECTION("Checking stealing of grains...") {
+            auto *scheduler = new WorkStealingScheduler(2, true);
+            scheduler->distribute(10, 3);
+            while (scheduler->fetch(0, onset, offset)) {
+                REQUIRE(offset <= 3);
+                for (unsigned int k = onset; k < onset + offset; k++) {
+                    counts.at(k) += 1;
+                }
+            }
+            REQUIRE(!scheduler->fetch(1, onset, offset));
+            for (auto count : counts) {
+                REQUIRE(count == 1);
+            }
+            delete scheduler;
+        }
+
+        SECTION("Checking static partition of grains...") {
+            auto *scheduler = new WorkStealingScheduler(2, false);
+            scheduler->distribute(10, 3);
+            while (scheduler->fetch(0, onset, offset)) {
+                for (unsigned int k = onset; k < onset + offset; k++) {
+                    counts.at(k) += 1;
+                }
+            }
+            REQUIRE(counts.at(5) == 1);
+            REQUIRE(counts.at(6) == 0);
+            REQUIRE(scheduler->fetch(1, onset, offset));
+            REQUIRE(onset == 6);
+            delete scheduler;
+        }
+    }
+
+    auto *initializer = new Initializer(configuration, *builder, epoch, *pool);
     initializer->initializePopulation(*pop);
     SECTION("Initializer") {
         SECTION("Initializating a population...") {
@@ -256,7 +497,7 @@ TEST_CASE("Core", "[core]") {
 
     configuration.getEvaluatorConfiguration().threads = 2;
     auto *network = new SimpleEvolutionaryNetwork(configuration);
-    auto *evaluator = new Evaluator(configuration, *eval, *network);
+    auto *evaluator = new Evaluator(configuration, *eval, *network, *pool);
     SECTION("Evaluator") {
         SECTION("Evaluating a population...") {
             evaluator->evaluatePopulation(*pop);
@@ -265,10 +506,61 @@ TEST_CASE("Core", "[core]") {
             REQUIRE(pop->getIndividuals().at(1)->getRelevance().getFitness() == 1);
             REQUIRE(pop->getIndividuals().at(2)->getRelevance().getFitness() == 1);
         }
+
+        SECTION("Skipping evaluated individuals...") {
+            auto *original = pop->getIndividuals().at(0);
+            original->setEvaluated(true);
+            original->getRelevance().setFitness(0);
+            pop->setIndividual(0, original->clone());
+            delete original;
+            REQUIRE(pop->getIndividuals().at(0)->isEvaluated());
+            evaluator->evaluatePopulation(*pop);
+            REQUIRE(evaluator->getSkippedEvaluations() == 1);
+            REQUIRE(pop->getIndividuals().at(0)->getRelevance().getFitness() == 0);
+            REQUIRE(pop->getIndividuals().at(1)->getRelevance().getFitness() == 1);
+        }
     }
 
     delete evaluator;
 
+    SECTION("FitnessCache") {
+        SECTION("Caching fitness values...") {
+            auto *cache = new FitnessCache(2, 1);
+            float fitness = 0;
+            REQUIRE(!cache->lookup(1, fitness));
+            cache->insert(1, 10);
+            cache->insert(2, 20);
+            REQUIRE(cache->lookup(1, fitness));
+            REQUIRE(fitness == 10);
+            cache->insert(3, 30);
+            REQUIRE(!cache->lookup(1, fitness));
+            REQUIRE(cache->lookup(3, fitness));
+            REQUIRE(fitness == 30);
+            REQUIRE(cache->getHits() == 2);
+            REQUIRE(cache->getMisses() == 2);
+            REQUIRE(cache->getHitRate() == Approx(0.5f));
+            delete cache;
+        }
+
+        SECTION("Evaluating a population with a cache...") {
+            auto *cache = new FitnessCache(16, 4);
+            auto *cached = new Evaluator(configuration, *eval, *network, *pool, cache);
+            for (unsigned int k = 0; k < 2; k++) {
+                for (auto *individual : pop->getIndividuals()) {
+                    individual->getRelevance().setFitness(0);
+                    individual->setEvaluated(false);
+                }
+                cached->evaluatePopulation(*pop);
+            }
+            REQUIRE(cache->getHits() + cache->getMisses() == 6);
+            REQUIRE(cache->getHits() >= 3);
+            REQUIRE(pop->getIndividuals().at(0)->getRelevance().getFitness() == 1);
+            REQUIRE(pop->getIndividuals().at(2)->getRelevance().getFitness() == 1);
+            delete cached;
+            delete cache;
+        }
+    }
+
     SECTION("VariationSource") {
         auto *vs = new SimpleVariationSource(configuration);
         vs->setup(new std::vector<VariationSource *>(0));
@@ -308,14 +600,38 @@ TEST_CASE("Core", "[core]") {
             REQUIRE(offsprings.at(0) != parents.at(0));
             REQUIRE(dynamic_cast<SimpleIndividual *>(offsprings.at(0))->toString() == "first");
         }
+
+        SECTION("Checking compiled plan...") {
+            std::vector<Individual *> parents = pop->getIndividuals();
+            dynamic_cast<SimpleIndividual *>(parents.at(0))->setLabel("first");
+            auto *plan = new VariationPlan(*bo);
+            REQUIRE(plan->getSteps() == 2);
+            for (unsigned int k = 0; k < 3; k++) {
+                std::vector<Individual *> &offsprings = plan->execute(parents, *thread);
+                REQUIRE(offsprings.size() == 1);
+                REQUIRE(offsprings.at(0) != parents.at(0));
+                REQUIRE(dynamic_cast<SimpleIndividual *>(offsprings.at(0))->toString() == "first");
+            }
+
+            auto *vs = new SimpleVariationSource(configuration);
+            vs->setup(new std::vector<VariationSource *>(0));
+            auto *generic = new VariationPlan(*vs);
+            std::vector<Individual *> &offsprings = generic->execute(parents, *thread);
+            REQUIRE(offsprings.size() == parents.size());
+            REQUIRE(dynamic_cast<SimpleIndividual *>(offsprings.at(0))->toString() == "bred");
+            delete generic;
+            delete vs;
+            delete plan;
+        }
     }
 
     configuration.getBreederConfiguration().threads = 2;
-    auto *breeder = new Breeder(configuration, *bo);
+    auto *breeder = new Breeder(configuration, *bo, *pool);
     SECTION("Breeder") {
         dynamic_cast<SimpleIndividual *>(pop->getIndividuals().at(0))->setLabel("first");
         SECTION("Variating a population...") {
-            auto *offsprings = breeder->breedPopulation(*pop);
+            breeder->breedPopulation(*pop);
+            auto *offsprings = &pop->getOffsprings();
             REQUIRE(offsprings->at(0) != pop->getIndividuals().at(0));
             REQUIRE(offsprings->at(0)->toString() == pop->getIndividuals().at(0)->toString());
             REQUIRE(offsprings->at(1) != pop->getIndividuals().at(1));
@@ -324,6 +640,19 @@ TEST_CASE("Core", "[core]") {
             REQUIRE(offsprings->at(2)->toString() != pop->getIndividuals().at(2)->toString());
         }
 
+        SECTION("Recycling a population...") {
+            breeder->breedPopulation(*pop);
+            std::vector<Individual *> offsprings = pop->getOffsprings();
+            breeder->recyclePopulation(*pop);
+            REQUIRE(pop->getIndividuals().at(0) == nullptr);
+            REQUIRE(pop->getIndividuals().at(2) == nullptr);
+
+            pop->swap();
+            REQUIRE(pop->getIndividuals() == offsprings);
+            REQUIRE(pop->getOffsprings().at(0) == nullptr);
+            REQUIRE(pop->getOffsprings().at(2) == nullptr);
+        }
+
     }
 
     delete breeder;
@@ -337,9 +666,14 @@ TEST_CASE("Core", "[core]") {
         configuration.getEvolutionarySystemConfiguration().episodes = 2;
         configuration.getEvolutionarySystemConfiguration().generations = 1;
         auto *p = new Population(configuration);
-        auto *init = new Initializer(configuration, *builder, epoch);
+        auto *init = new Initializer(configuration, *builder, epoch, *pool);
         init->initializePopulation(*p);
         auto *statistics = new Statistics(configuration);
+        configuration.getStatisticsConfiguration().threads = 2;
+        configuration.getStatisticsConfiguration().series = Statistics::BEST_COST | Statistics::MOST_RELEVANT_FITNESS;
+        auto *selection = new Statistics(configuration, *pool);
+        configuration.getStatisticsConfiguration().threads = 1;
+        configuration.getStatisticsConfiguration().series = Statistics::ALL_SERIES;
         for (unsigned int k = 0; k < 3; k++) {
             p->getIndividuals().at(0)->getRelevance().setFraction(k / 2.0f);
             p->getIndividuals().at(0)->getRelevance().setCost(10);
@@ -348,11 +682,13 @@ TEST_CASE("Core", "[core]") {
             p->getIndividuals().at(1)->getRelevance().setCost(5);
             p->getIndividuals().at(1)->getRelevance().setFitness(2.5);
             statistics->record(*p, k, 0);
+            selection->record(*p, k, 0);
             p->getIndividuals().at(0)->getRelevance().setCost(0);
             p->getIndividuals().at(0)->getRelevance().setFitness(7.5);
             p->getIndividuals().at(1)->getRelevance().setCost(2.5);
             p->getIndividuals().at(1)->getRelevance().setFitness(2.5);
             statistics->record(*p, k, 0);
+            selection->record(*p, k, 0);
         }
 
         SECTION("Checking best cost recording...") {
@@ -433,6 +769,16 @@ TEST_CASE("Core", "[core]") {
             REQUIRE(statistics->leastRelevantFitness(2).at(0) == 1.25f);
         }
 
+        SECTION("Checking parallel recording of selected series...") {
+            for (unsigned int k = 0; k < 3; k++) {
+                REQUIRE(selection->bestCost(k).at(0) == statistics->bestCost(k).at(0));
+                REQUIRE(selection->mostRelevantFitness(k).at(0) == statistics->mostRelevantFitness(k).at(0));
+                REQUIRE(selection->averageCost(k).at(0) == 0);
+                REQUIRE(selection->leastRelevantCost(k).at(0) == 0);
+            }
+        }
+
+        delete selection;
         delete statistics;
         delete init;
         delete p;
@@ -453,8 +799,26 @@ TEST_CASE("Core", "[core]") {
         delete system;
     }
 
+    configuration.getEvolutionarySystemConfiguration().episodes = 4;
+    configuration.getEvolutionarySystemConfiguration().concurrency = 2;
+    SECTION("Concurrent episodes") {
+        auto *system = new EvolutionarySystem(configuration, *builder, *eval, *network, *bo);
+
+        SECTION("Merging the statistics of concurrent lanes...") {
+            system->run();
+            for (unsigned int k = 0; k <= 10; k++) {
+                REQUIRE(system->getStatistics().averageFitness(0).at(k) == 1.0f);
+                REQUIRE(system->getStatistics().worstFitness(0).at(k) == 1.0f);
+            }
+        }
+
+        delete system;
+    }
+    configuration.getEvolutionarySystemConfiguration().concurrency = 1;
+
     delete bo;
     delete network;
+    delete pool;
     delete builder;
     delete session;
     delete problem;
@@ -1,3 +1,5 @@
+#include <bitset>
+#include <algorithm>
 #include <catch.hpp>
 #include <iostream>
 #include "../cc/common/Problem.h"
@@ -6,6 +8,7 @@
 #include "../cc/common/FitnessProportionateSelection.h"
 #include "../cc/ndga/BitVectorCrossover.h"
 #include "../cc/ndga/BitVectorMutation.h"
+#include "../core/variation/VariationPlan.h"
 #include "../cc/ndga/Session.h"
 #include "../cc/ndga/EvaluationFunctions.h"
 #include "util/SimpleEvaluationFunction.h"
@@ -26,7 +29,7 @@ TEST_CASE("NDGA", "[ndga]") {
 
     auto *featurevector = new FeatureVector(*configuration);
     auto *relevance = new Relevance(*configuration);
-    auto *prototype = new VectorIndividual(*configuration, *featurevector, *relevance);
+    auto *prototype = new BitVectorIndividual(*configuration, *featurevector, *relevance);
     auto *builder = new RandomBitVectorBuilder(*configuration, *prototype);
     auto *pop = new Population(*configuration);
 
@@ -35,17 +38,18 @@ TEST_CASE("NDGA", "[ndga]") {
     delete prototype;
 
     unsigned int epoch = 0;
-    auto *initializer = new Initializer(*configuration, *builder, epoch);
+    auto *pool = new ThreadPool(*configuration);
+    auto *initializer = new Initializer(*configuration, *builder, epoch, *pool);
     SECTION("RandomBitVectorBuilder") {
         SECTION("Checking initialization...") {
             std::vector<unsigned int> counts(8, 0);
             for (unsigned int k = 1; k <= 1000; k++) {
                 initializer->initializePopulation(*pop);
-                std::vector<float> &chromosome = dynamic_cast<VectorIndividual *>(pop->getIndividuals().at(0))->getChromosome();
+                auto *individual = dynamic_cast<BitVectorIndividual *>(pop->getIndividuals().at(0));
 
                 unsigned int index = 0;
-                for (unsigned int l = 0; l < chromosome.size(); l++) {
-                    index += static_cast<unsigned int>(chromosome.at(chromosome.size() - 1 - l)) * pow(2, l);
+                for (unsigned int l = 0; l < genes; l++) {
+                    index += static_cast<unsigned int>(individual->getGene(genes - 1 - l)) * pow(2, l);
                 }
 
                 counts.at(index) += 1;
@@ -59,6 +63,26 @@ TEST_CASE("NDGA", "[ndga]") {
                 REQUIRE(counts.at(k + 1) <= counts.at(k) + tolerance);
             }
         }
+
+        SECTION("Checking reproducibility regardless of threads...") {
+            Clock clock;
+            clock.seed = 7;
+            auto *seeded = new Initializer(*configuration, *builder, epoch, *pool, &clock);
+            seeded->initializePopulation(*pop);
+            std::vector<std::string> chromosomes;
+            for (auto *individual : pop->getIndividuals())
+                chromosomes.push_back(individual->toString());
+
+            configuration->getInitializerConfiguration().threads = 2;
+            auto *concurrent = new Initializer(*configuration, *builder, epoch, *pool, &clock);
+            concurrent->initializePopulation(*pop);
+            for (unsigned int k = 0; k < chromosomes.size(); k++)
+                REQUIRE(pop->getIndividuals().at(k)->toString() == chromosomes.at(k));
+
+            configuration->getInitializerConfiguration().threads = 1;
+            delete concurrent;
+            delete seeded;
+        }
     }
 
     delete builder;
@@ -78,31 +102,29 @@ TEST_CASE("NDGA", "[ndga]") {
     SECTION("BitVectorCrossover") {
         SECTION("Checking breeding...") {
             std::vector<Individual *> parents = pop->getIndividuals();
-            std::vector<float> &parent1 = dynamic_cast<VectorIndividual *>(parents.at(0))->getChromosome();
-            parent1.at(0) = 1;
-            parent1.at(1) = 1;
-            parent1.at(2) = 1;
-            std::vector<float> &parent2 = dynamic_cast<VectorIndividual *>(parents.at(1))->getChromosome();
-            parent2.at(0) = 0;
-            parent2.at(1) = 0;
-            parent2.at(2) = 0;
+            auto *parent1 = dynamic_cast<BitVectorIndividual *>(parents.at(0));
+            parent1->setGene(0, true);
+            parent1->setGene(1, true);
+            parent1->setGene(2, true);
+            auto *parent2 = dynamic_cast<BitVectorIndividual *>(parents.at(1));
+            parent2->setGene(0, false);
+            parent2->setGene(1, false);
+            parent2->setGene(2, false);
 
             std::vector<bool> used = {false, false, false};
             for (int k = 1; k <= 10000; k++) {
                 std::vector<Individual *> offsprings = crossover->vary(parents, *thread);
 
-                std::vector<float> &offspring1 = dynamic_cast<VectorIndividual *>(offsprings.at(0))->getChromosome();
-                std::vector<float> &offspring2 = dynamic_cast<VectorIndividual *>(offsprings.at(1))->getChromosome();
+                auto *offspring1 = dynamic_cast<BitVectorIndividual *>(offsprings.at(0));
+                auto *offspring2 = dynamic_cast<BitVectorIndividual *>(offsprings.at(1));
 
-                if (offspring1.at(0) == 0 && offspring2.at(1) == 1) {
-                    auto o = std::vector<float>(offspring1);
-                    offspring1 = offspring2;
-                    offspring2 = o;
+                if (!offspring1->getGene(0) && offspring2->getGene(1)) {
+                    std::swap(offspring1, offspring2);
                 }
 
                 unsigned int crossover_point = 0;
                 for (unsigned int cp = 0; cp < genes; cp++)  {
-                    if ((parent1.at(cp) != offspring1.at(cp) && parent2.at(cp) != offspring2.at(cp))) {
+                    if ((parent1->getGene(cp) != offspring1->getGene(cp) && parent2->getGene(cp) != offspring2->getGene(cp))) {
                         break;
                     }
                     crossover_point += 1;
@@ -111,7 +133,7 @@ TEST_CASE("NDGA", "[ndga]") {
 
                 bool crossed = true;
                 for (unsigned int cp = crossover_point + 1; cp < genes; cp++) {
-                    crossed &= (parent1.at(cp) == offspring2.at(cp) && parent2.at(cp) == offspring1.at(cp));
+                    crossed &= (parent1->getGene(cp) == offspring2->getGene(cp) && parent2->getGene(cp) == offspring1->getGene(cp));
                 }
 
                 if (crossed) {
@@ -129,6 +151,29 @@ TEST_CASE("NDGA", "[ndga]") {
             REQUIRE(used.at(1));
             REQUIRE(used.at(2));
         }
+
+        SECTION("Checking exact breeding...") {
+            std::vector<Individual *> parents = pop->getIndividuals();
+            std::vector<std::string> chromosomes;
+            for (auto *parent : parents)
+                chromosomes.push_back(parent->toString());
+
+            auto *plan = new VariationPlan(*crossover);
+            for (unsigned long needed = 1; needed <= 2; needed++) {
+                for (unsigned int k = 0; k < 100; k++) {
+                    std::vector<Individual *> &offsprings = plan->execute(parents, *thread, needed);
+                    REQUIRE(offsprings.size() == needed);
+                    for (auto *offspring : offsprings) {
+                        REQUIRE(std::find(parents.begin(), parents.end(), offspring) == parents.end());
+                        delete offspring;
+                    }
+                }
+            }
+            REQUIRE(thread->pool.getSize() == 0);
+            for (unsigned int k = 0; k < parents.size(); k++)
+                REQUIRE(parents.at(k)->toString() == chromosomes.at(k));
+            delete plan;
+        }
     }
 
     delete crossover;
@@ -142,14 +187,15 @@ TEST_CASE("NDGA", "[ndga]") {
     mutation->setup(sources);
     SECTION("BitVectorMutation") {
         SECTION("Checking breeding...") {
-            auto &parent1 = dynamic_cast<VectorIndividual *>(pop->getIndividuals().at(0))->getChromosome();
-            auto &parent2 = dynamic_cast<VectorIndividual *>(pop->getIndividuals().at(1))->getChromosome();
+            auto &parent1 = dynamic_cast<BitVectorIndividual *>(pop->getIndividuals().at(0))->getChromosome();
+            auto &parent2 = dynamic_cast<BitVectorIndividual *>(pop->getIndividuals().at(1))->getChromosome();
 
             std::vector<Individual *> offsprings = mutation->vary(pop->getIndividuals(), *thread);
-            auto &offspring = dynamic_cast<VectorIndividual *>(offsprings.at(0))->getChromosome();
+            auto *mutant = dynamic_cast<BitVectorIndividual *>(offsprings.at(0));
             for (unsigned int k = 0; k < genes; k++) {
-                offspring.at(k) = 1 - offspring.at(k);
+                mutant->flipGene(k);
             }
+            auto &offspring = mutant->getChromosome();
 
             if (parent1 != offspring) {
                 REQUIRE(parent2 == offspring);
@@ -157,11 +203,44 @@ TEST_CASE("NDGA", "[ndga]") {
                 REQUIRE(parent1 == offspring);
             }
         }
+
+        SECTION("Checking geometric sampling...") {
+            auto *p = new common::Problem(*eval, 1, 6400);
+            auto *c = new common::Configuration(dynamic_cast<common::Configuration::ProblemConfiguration &>(p->getConfiguration()));
+            c->getMutationConfiguration().mutation_rate = 0.05;
+            auto *m = new BitVectorMutation(*c);
+            auto *selection = new FitnessProportionateSelection(*c);
+            selection->setup(new std::vector<VariationSource *>(0));
+            m->setup(new std::vector<VariationSource *> { selection });
+            auto *fv = new FeatureVector(*c);
+            auto *r = new Relevance(*c);
+            auto *individual = new BitVectorIndividual(*c, *fv, *r);
+            std::vector<Individual *> parents = { individual };
+
+            unsigned int flips = 0;
+            for (unsigned int k = 0; k < 10; k++) {
+                std::vector<Individual *> offsprings = m->vary(parents, *thread);
+                auto &mutant = dynamic_cast<BitVectorIndividual *>(offsprings.at(0))->getChromosome();
+                for (unsigned int l = 0; l < mutant.size(); l++)
+                    flips += std::bitset<64>(mutant.at(l) ^ individual->getChromosome().at(l)).count();
+                delete offsprings.at(0);
+            }
+            REQUIRE(flips > 2900);
+            REQUIRE(flips < 3500);
+
+            delete individual;
+            delete r;
+            delete fv;
+            delete m;
+            delete c;
+            delete p;
+        }
     }
 
     delete mutation;
     delete pop;
     delete initializer;
+    delete pool;
 
     SECTION("EvaluationFunctions") {
         SECTION("Checking OneMaxProblem...") {
@@ -182,6 +261,55 @@ TEST_CASE("NDGA", "[ndga]") {
             delete p;
             delete e;
         }
+
+        SECTION("Checking batched evaluation...") {
+            auto *fv = new FeatureVector(*configuration);
+            auto *r = new Relevance(*configuration);
+            std::vector<Individual *> batch;
+            std::vector<Individual *> singles;
+            for (unsigned int k = 0; k <= genes; k++) {
+                auto *individual = new BitVectorIndividual(*configuration, *fv, *r);
+                for (unsigned int l = 0; l < k; l++)
+                    individual->setGene(l, true);
+                batch.push_back(individual);
+                singles.push_back(individual->clone());
+            }
+
+            std::vector<unsigned int> slots(batch.size());
+            for (unsigned int k = 0; k < slots.size(); k++)
+                slots.at(k) = k;
+
+            auto *t = new Thread(0, 1);
+            std::vector<EvaluationFunction *> evals = {
+                    ndga::EvaluationFunctions::evalOneMax(),
+                    ndga::EvaluationFunctions::evalNarrowedOneMax(),
+                    ndga::EvaluationFunctions::evalDeceptiveOneMax()
+            };
+            for (auto *e : evals) {
+                REQUIRE(e->isBatched());
+                for (unsigned int k = 0; k < batch.size(); k++) {
+                    batch.at(k)->setEvaluated(false);
+                    singles.at(k)->setEvaluated(false);
+                    e->operator()(*singles.at(k), *t);
+                }
+                e->evaluateBatch(batch, slots, *t, nullptr);
+                for (unsigned int k = 0; k < batch.size(); k++) {
+                    REQUIRE(batch.at(k)->isEvaluated());
+                    REQUIRE(batch.at(k)->getRelevance().getFitness() == singles.at(k)->getRelevance().getFitness());
+                }
+                delete e;
+            }
+            REQUIRE(batch.at(0)->getRelevance().getFitness() == 1);
+            REQUIRE(batch.at(genes)->getRelevance().getFitness() == 0);
+
+            for (unsigned int k = 0; k < batch.size(); k++) {
+                delete batch.at(k);
+                delete singles.at(k);
+            }
+            delete t;
+            delete r;
+            delete fv;
+        }
     }
 
     delete configuration;
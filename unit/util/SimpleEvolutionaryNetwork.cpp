@@ -12,6 +12,6 @@ SimpleEvolutionaryNetwork* SimpleEvolutionaryNetwork::clone() const {
     return new SimpleEvolutionaryNetwork(*this);
 }
 
-std::vector<unsigned int> SimpleEvolutionaryNetwork::preprocess(std::vector<Individual *> &individuals) const {
-    return std::vector<unsigned int>(individuals.size());
+std::vector<unsigned long long> SimpleEvolutionaryNetwork::preprocess(std::vector<Individual *> &individuals) const {
+    return std::vector<unsigned long long>(individuals.size());
 }
\ No newline at end of file
@@ -23,7 +23,7 @@ public:
     SimpleEvolutionaryNetwork * clone() const override;
 
 protected:
-    std::vector<unsigned int> preprocess(std::vector<Individual *> &individuals) const override;
+    std::vector<unsigned long long> preprocess(std::vector<Individual *> &individuals) const override;
 
     SimpleEvolutionaryNetwork(const SimpleEvolutionaryNetwork &obj) = default;
 
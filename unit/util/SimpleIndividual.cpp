@@ -1,5 +1,6 @@
 #include "SimpleIndividual.h"
 
+#include <functional>
 #include <utility>
 
 SimpleIndividual::SimpleIndividual(const core::Configuration &configuration, FeatureMap &featuremap, Relevance &relevance)
@@ -17,6 +18,21 @@ SimpleIndividual * SimpleIndividual::clone() const {
     return new SimpleIndividual(*this);
 }
 
+bool SimpleIndividual::assign(const Individual &obj) {
+    auto *other = dynamic_cast<const SimpleIndividual *>(&obj);
+    if (other == nullptr)
+        return false;
+
+    assignState(obj);
+    this->label = other->label;
+    return true;
+}
+
+bool SimpleIndividual::hash(unsigned long long &key) const {
+    key = std::hash<std::string>()(label);
+    return true;
+}
+
 SimpleIndividual::SimpleIndividual(const SimpleIndividual &obj) : Individual(obj) {
     this->label = obj.label;
 }
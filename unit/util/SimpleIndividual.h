@@ -20,6 +20,10 @@ public:
 
     SimpleIndividual * clone() const override;
 
+    bool assign(const Individual &obj) override;
+
+    bool hash(unsigned long long &key) const override;
+
     void setLabel(std::string label);
 
 protected:
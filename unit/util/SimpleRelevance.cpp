@@ -0,0 +1,17 @@
+#include "SimpleRelevance.h"
+
+SimpleRelevance::SimpleRelevance(const core::Configuration &configuration) : Relevance(configuration) {}
+
+bool SimpleRelevance::operator<(const Relevance &other) const {
+    return this->getCost() > other.getCost();
+}
+
+bool SimpleRelevance::operator>(const Relevance &other) const {
+    return this->getCost() < other.getCost();
+}
+
+SimpleRelevance * SimpleRelevance::clone() const {
+    return new SimpleRelevance(*this);
+}
+
+SimpleRelevance::SimpleRelevance(const SimpleRelevance &obj) : Relevance(obj) {}
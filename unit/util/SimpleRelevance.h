@@ -0,0 +1,31 @@
+#ifndef RATATOSKR_UNIT_SIMPLERELEVANCE_H
+#define RATATOSKR_UNIT_SIMPLERELEVANCE_H
+
+
+#include "../../core/representation/Relevance.h"
+
+/**
+ * A simple instance of Relevance to test core functionality. It compares individuals by their cost only, i.e. its
+ * order differs from the conventional relevance unless the fraction is 1.
+ *
+ * @author  Felix Voelker
+ * @version 0.1.0
+ * @since   25.1.2018
+ */
+class SimpleRelevance : public Relevance {
+
+public:
+    explicit SimpleRelevance(const core::Configuration &configuration);
+
+    bool operator<(const Relevance &other) const override;
+    bool operator>(const Relevance &other) const override;
+
+    SimpleRelevance * clone() const override;
+
+protected:
+    SimpleRelevance(const SimpleRelevance &obj);
+
+};
+
+
+#endif //RATATOSKR_UNIT_SIMPLERELEVANCE_H